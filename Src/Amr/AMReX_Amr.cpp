@@ -82,6 +82,9 @@ namespace
     int  checkpoint_nfiles;
     int  regrid_on_restart;
     int  use_efficient_regrid;
+    int  regrid_keep_owners;
+    int  async_subcycle;
+    Real regrid_skip_threshold;
     int  plotfile_on_restart;
     int  insitu_on_restart;
     int  checkpoint_on_restart;
@@ -118,6 +121,9 @@ Amr::Initialize ()
     checkpoint_nfiles        = 64;
     regrid_on_restart        = 0;
     use_efficient_regrid     = 0;
+    regrid_keep_owners       = 0;
+    async_subcycle           = 0;
+    regrid_skip_threshold    = 0.0;
     plotfile_on_restart      = 0;
     insitu_on_restart        = 0;
     checkpoint_on_restart    = 0;
@@ -258,6 +264,9 @@ Amr::InitAmr ()
     //
     pp.query("regrid_on_restart",regrid_on_restart);
     pp.query("use_efficient_regrid",use_efficient_regrid);
+    pp.query("regrid_keep_owners",regrid_keep_owners);
+    pp.query("async_subcycle",async_subcycle);
+    pp.query("regrid_skip_threshold",regrid_skip_threshold);
     pp.query("plotfile_on_restart",plotfile_on_restart);
     pp.query("insitu_on_restart",insitu_on_restart);
     pp.query("checkpoint_on_restart",checkpoint_on_restart);
@@ -2017,6 +2026,15 @@ Amr::timeStep (int  level,
 
     dt_min[level] = iteration == 1 ? dt_new : std::min(dt_min[level],dt_new);
 
+    //
+    // The work the level deferred to post_timestep, e.g., the finish of
+    // communication, overlaps with the advance of the finer levels only
+    // if async_subcycle is set.
+    //
+    if (!async_subcycle) {
+        amr_level[level]->finishDeferred();
+    }
+
     level_steps[level]++;
     level_count[level]++;
 
@@ -2030,6 +2048,8 @@ Amr::timeStep (int  level,
     // occurred, do that now.
     if (amr_level[level]->postStepRegrid()) {
 
+        amr_level[level]->finishDeferred();
+
         int old_finest = finest_level;
 
         regrid(level, time);
@@ -2068,7 +2088,9 @@ Amr::timeStep (int  level,
         }
     }
 
+    amr_level[level]->finishDeferred();
     amr_level[level]->post_timestep(iteration);
+    amr_level[level]->clearFillPatchCache();
 
     // Set this back to negative so we know whether we are in fact in this routine
     which_level_being_advanced = -1;
@@ -2585,6 +2607,32 @@ Amr::regrid (int  lbase,
         return;
     }
 
+    //
+    // If regrid_skip_threshold is set, skip regrids that would change few cells.
+    //
+    if (!initial && (regrid_skip_threshold > 0.0 || verbose > 1))
+    {
+        for (int lev = start; lev <= new_finest; ++lev) {
+            if (new_dmap[lev].empty()) {
+                new_dmap[lev] = makeProposedDistributionMap(lev, new_grid_places[lev]);
+            }
+        }
+        const RegridMetrics metrics = ComputeRegridMetrics(start, new_finest, new_grid_places,
+                                                           new_dmap, regridBytesPerCell());
+        if (verbose > 1) {
+            amrex::Print() << "Regrid metrics at level lbase = " << lbase << "\n" << metrics;
+        }
+        if (regrid_skip_threshold > 0.0 && new_finest == finest_level
+            && metrics.churn() < regrid_skip_threshold)
+        {
+            if (verbose > 0) {
+                amrex::Print() << "Regridding at level lbase = " << lbase
+                               << " skipped, churn = " << metrics.churn() << "\n";
+            }
+            return;
+        }
+    }
+
     //
     // Reclaim old-time grid space for all remain levels > lbase.
     // But skip this if we're in the middle of a post-timestep regrid.
@@ -2617,7 +2665,11 @@ Amr::regrid (int  lbase,
             new_dmap[lev] = makeLoadBalanceDistributionMap(lev, time, new_grid_places[lev]);
         }
         else if (new_dmap[lev].empty()) {
-            new_dmap[lev].define(new_grid_places[lev]);
+            if (initial) {
+                new_dmap[lev].define(new_grid_places[lev]);
+            } else {
+                new_dmap[lev] = makeProposedDistributionMap(lev, new_grid_places[lev]);
+            }
         }
 
         AmrLevel* a = (*levelbld)(*this,lev,Geom(lev),new_grid_places[lev],
@@ -2745,6 +2797,9 @@ Amr::makeLoadBalanceDistributionMap (int lev, Real time, const BoxArray& ba) con
 
         MultiFab workest(ba, dmtmp, 1, 0, MFInfo(), FArrayBoxFactory());
         AmrLevel::FillPatch(*amr_level[lev], workest, 0, time, work_est_type, 0, 1, 0);
+#ifdef AMREX_PARTICLES
+        amr_level[lev]->addParticleWorkEstimate(workest);
+#endif
 
         Real navg = static_cast<Real>(ba.size()) / static_cast<Real>(ParallelDescriptor::NProcs());
         int nmax = static_cast<int>(std::max(std::round(loadbalance_max_fac*navg), std::ceil(navg)));
@@ -2759,6 +2814,50 @@ Amr::makeLoadBalanceDistributionMap (int lev, Real time, const BoxArray& ba) con
     return newdm;
 }
 
+DistributionMapping
+Amr::makeRegridDistributionMap (int lev, const BoxArray& ba) const
+{
+    BL_PROFILE("makeRegridDistributionMap()");
+
+    const BoxArray& old_ba = boxArray(lev);
+    const DistributionMapping& old_dm = DistributionMap(lev);
+    const int nprocs = ParallelDescriptor::NProcs();
+
+    // Boxes that are in the old grids keep their owner.
+    const int N = ba.size();
+    Vector<int> pmap(N, -1);
+    Vector<Long> load(nprocs, 0);
+    std::vector<std::pair<int,Box> > isects;
+    for (int i = 0; i < N; ++i)
+    {
+        old_ba.intersections(ba[i], isects);
+        for (auto const& is : isects) {
+            if (old_ba[is.first] == ba[i]) {
+                pmap[i] = old_dm[is.first];
+                load[pmap[i]] += ba[i].numPts();
+                break;
+            }
+        }
+    }
+
+    // The other boxes, largest first, go to the least loaded process.
+    Vector<int> order;
+    for (int i = 0; i < N; ++i) {
+        if (pmap[i] < 0) order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&ba] (int a, int b) {
+        return ba[a].numPts() > ba[b].numPts();
+    });
+    for (int i : order) {
+        int p = static_cast<int>(std::distance(load.begin(),
+                                               std::min_element(load.begin(), load.end())));
+        pmap[i] = p;
+        load[p] += ba[i].numPts();
+    }
+
+    return DistributionMapping(std::move(pmap));
+}
+
 void
 Amr::LoadBalanceLevel0 (Real time)
 {
@@ -2883,6 +2982,52 @@ Amr::printGridInfo (std::ostream& os,
     os << std::endl; // Make sure we flush!
 }
 
+DistributionMapping
+Amr::makeProposedDistributionMap (int lev, const BoxArray& ba) const
+{
+    if (regrid_keep_owners && amr_level[lev]) {
+        return makeRegridDistributionMap(lev, ba);
+    } else {
+        return DistributionMapping(ba);
+    }
+}
+
+Long
+Amr::regridBytesPerCell () const
+{
+    const DescriptorList& desc_lst = AmrLevel::get_desc_lst();
+    Long ncomp = 0;
+    for (int typ = 0; typ < desc_lst.size(); ++typ) {
+        ncomp += desc_lst[typ].nComp();
+    }
+    return ncomp * static_cast<Long>(sizeof(Real));
+}
+
+RegridMetrics
+Amr::regridDryRun (int lbase, Real time)
+{
+    BL_PROFILE("Amr::regridDryRun()");
+
+    int new_finest = finest_level;
+    Vector<BoxArray> new_grid_places(max_level+1);
+    Vector<DistributionMapping> new_dmap(max_level+1);
+
+    if (lbase <= std::min(finest_level,max_level-1)) {
+        grid_places(lbase,time,new_finest,new_grid_places);
+    }
+
+    const int start = (lbase == 0 && new_grid_places[0] != amr_level[0]->boxArray()) ? 0 : lbase+1;
+
+    for (int lev = start; lev <= new_finest; ++lev) {
+        if (lev <= finest_level && new_grid_places[lev] == amr_level[lev]->boxArray()) {
+            new_dmap[lev] = amr_level[lev]->DistributionMap();
+        } else {
+            new_dmap[lev] = makeProposedDistributionMap(lev, new_grid_places[lev]);
+        }
+    }
+
+    return ComputeRegridMetrics(start, new_finest, new_grid_places, new_dmap, regridBytesPerCell());
+}
 
 void
 Amr::grid_places (int              lbase,
@@ -164,7 +164,7 @@ AmrLevel::writePlotFile (const std::string& dir,
     }
 
     int num_derive = 0;
-    std::vector<std::string> derive_names;
+    Vector<std::string> derive_names;
     const std::list<DeriveRec>& dlist = derive_lst.dlist();
     for (auto const& d : dlist)
     {
@@ -337,11 +337,8 @@ AmrLevel::writePlotFile (const std::string& dir,
     // derived
     if (derive_names.size() > 0)
     {
-        for (auto const& dname : derive_names)
-        {
-            derive(dname, cur_time, plotMF, cnt);
-            cnt += derive_lst.get(dname)->numDerive();
-        }
+        derive(derive_names, cur_time, plotMF, cnt);
+        cnt += num_derive;
     }
 
 #ifdef AMREX_USE_EB
@@ -465,7 +462,63 @@ AmrLevel::set_state_in_checkpoint (Vector<int>& /*state_in_checkpoint*/)
 }
 
 void
-AmrLevel::finishConstructor () {}
+AmrLevel::finishConstructor ()
+{
+    ParmParse pp("amr");
+    pp.query("fillpatch_cache", m_fillpatch_cache_size);
+}
+
+Vector<Long>
+AmrLevel::fillPatchCacheVersions (int state_indx) const
+{
+    Vector<Long> versions(level+1);
+    for (int lev = 0; lev < level; ++lev) {
+        versions[lev] = parent->getLevel(lev).state[state_indx].version();
+    }
+    versions[level] = state[state_indx].version();
+    return versions;
+}
+
+const MultiFab*
+AmrLevel::findFillPatchCache (const MultiFab& leveldata, int boxGrow, Real time,
+                              int state_indx, int scomp, int ncomp,
+                              const Vector<Long>& versions) const
+{
+    for (auto const& e : m_fillpatch_cache) {
+        if (e.state_indx == state_indx && e.time == time && e.scomp == scomp &&
+            e.ncomp == ncomp && e.ngrow == boxGrow && e.versions == versions &&
+            e.mf->boxArray() == leveldata.boxArray() &&
+            e.mf->DistributionMap() == leveldata.DistributionMap())
+        {
+            return e.mf.get();
+        }
+    }
+    return nullptr;
+}
+
+void
+AmrLevel::addFillPatchCache (const MultiFab& filled, Real time, int state_indx, int scomp,
+                             Vector<Long>&& versions)
+{
+    const int ncomp = filled.nComp();
+    const int ngrow = filled.nGrow();
+
+    // Entries with the same key are stale.
+    m_fillpatch_cache.erase(std::remove_if(m_fillpatch_cache.begin(), m_fillpatch_cache.end(),
+        [&] (FillPatchCacheEntry const& e) {
+            return e.state_indx == state_indx && e.time == time && e.scomp == scomp &&
+                e.ncomp == ncomp && e.ngrow == ngrow;
+        }), m_fillpatch_cache.end());
+    while (static_cast<int>(m_fillpatch_cache.size()) >= m_fillpatch_cache_size) {
+        m_fillpatch_cache.pop_front();
+    }
+
+    auto mf = std::make_unique<MultiFab>(filled.boxArray(), filled.DistributionMap(), ncomp, ngrow,
+                                         MFInfo(), filled.Factory());
+    MultiFab::Copy(*mf, filled, 0, 0, ncomp, ngrow);
+    m_fillpatch_cache.push_back(FillPatchCacheEntry{state_indx, time, scomp, ncomp, ngrow,
+                                                    std::move(versions), std::move(mf)});
+}
 
 void
 AmrLevel::setTimeLevel (Real time,
@@ -1001,6 +1054,25 @@ FillPatchIterator::Initialize (int  boxGrow,
 
     const Geometry& geom = m_amrlevel.Geom();
 
+    // Only fills of the old time level are kept.  The new data are
+    // written during an advance, often through a reference obtained
+    // before the fill, which StateData::version() does not see.
+    const StateData& statedata = m_amrlevel.state[idx];
+    const bool use_cache = m_amrlevel.m_fillpatch_cache_size > 0
+        && statedata.hasOldData() && time == statedata.prevTime();
+
+    Vector<Long> versions;
+    if (use_cache)
+    {
+        versions = m_amrlevel.fillPatchCacheVersions(idx);
+        const MultiFab* cached = m_amrlevel.findFillPatchCache(m_leveldata, boxGrow, time,
+                                                               idx, scomp, ncomp, versions);
+        if (cached) {
+            MultiFab::Copy(m_fabs, *cached, 0, 0, m_ncomp, boxGrow);
+            return;
+        }
+    }
+
     m_fabs.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), geom);
 
     const IndexType& boxType = m_leveldata.boxArray().ixType();
@@ -1089,6 +1161,10 @@ FillPatchIterator::Initialize (int  boxGrow,
                                              0,
                                              ncomp,
                                              time);
+
+    if (use_cache) {
+        m_amrlevel.addFillPatchCache(m_fabs, time, idx, scomp, std::move(versions));
+    }
 }
 
 void
@@ -1605,6 +1681,94 @@ AmrLevel::FillCoarsePatch (MultiFab& mf,
     }
 }
 
+void
+AmrLevel::finishDeferred ()
+{
+    for (auto& f : m_deferred) {
+        f();
+    }
+    m_deferred.clear();
+}
+
+int
+AmrLevel::FillFromOldLevel (AmrLevel& old, Real time, int idx)
+{
+    BL_PROFILE("AmrLevel::FillFromOldLevel()");
+
+    BL_ASSERT(old.level == level);
+    BL_ASSERT(0 <= idx && idx < desc_lst.size());
+
+    MultiFab& S_new = get_new_data(idx);
+    MultiFab& S_old = old.get_new_data(idx);
+    const int ncomp = S_new.nComp();
+
+    bool can_move = old.state[idx].curTime() == time
+        && S_old.nComp() == ncomp
+        && S_old.nGrowVect() == S_new.nGrowVect()
+        && S_old.ixType() == S_new.ixType();
+#ifdef AMREX_USE_EB
+    // The EB data of the FABs belong to the factory of the old level.
+    can_move = can_move && (EB2::TopIndexSpaceIfPresent() == nullptr);
+#endif
+
+    if (!can_move) {
+        FillPatch(old, S_new, 0, time, idx, 0, ncomp);
+        return 0;
+    }
+
+    // Grids with the same box and owner in both levels.  This only uses
+    // the metadata, so all the processes agree.
+    const BoxArray& ba = S_new.boxArray();
+    const DistributionMapping& dm = S_new.DistributionMap();
+    const BoxArray& old_ba = S_old.boxArray();
+    const DistributionMapping& old_dm = S_old.DistributionMap();
+
+    Vector<int> old_index(ba.size(), -1);
+    BoxList bl_changed(ba.ixType());
+    Vector<int> pmap_changed;
+    Vector<int> changed_index(ba.size(), -1);
+    int nmoved = 0;
+    std::vector<std::pair<int,Box> > isects;
+    for (int i = 0, N = ba.size(); i < N; ++i)
+    {
+        const Box& bx = ba[i];
+        old_ba.intersections(bx, isects);
+        for (auto const& is : isects) {
+            if (old_ba[is.first] == bx && old_dm[is.first] == dm[i]) {
+                old_index[i] = is.first;
+                break;
+            }
+        }
+        if (old_index[i] >= 0) {
+            ++nmoved;
+        } else {
+            changed_index[i] = static_cast<int>(pmap_changed.size());
+            bl_changed.push_back(bx);
+            pmap_changed.push_back(dm[i]);
+        }
+    }
+
+    // Fill the other grids, with the ghost cells of S_new so that their
+    // FABs can be moved too.
+    MultiFab mf_changed;
+    if (!pmap_changed.empty())
+    {
+        mf_changed.define(BoxArray(std::move(bl_changed)), DistributionMapping(std::move(pmap_changed)),
+                          ncomp, S_new.nGrowVect());
+        FillPatch(old, mf_changed, 0, time, idx, 0, ncomp);
+    }
+
+    for (MFIter mfi(S_new); mfi.isValid(); ++mfi)
+    {
+        const int i = mfi.index();
+        FArrayBox* fab = (old_index[i] >= 0) ? S_old.release(old_index[i])
+                                             : mf_changed.release(changed_index[i]);
+        S_new.setFab(mfi, std::unique_ptr<FArrayBox>(fab));
+    }
+
+    return nmoved;
+}
+
 std::unique_ptr<MultiFab>
 AmrLevel::derive (const std::string& name, Real time, int ngrow)
 {
@@ -1724,109 +1888,226 @@ AmrLevel::derive (const std::string& name, Real time, int ngrow)
 void
 AmrLevel::derive (const std::string& name, Real time, MultiFab& mf, int dcomp)
 {
-    BL_ASSERT(dcomp < mf.nComp());
+    deriveBatch(Vector<std::string>{name}, time, mf, dcomp);
+}
+
+void
+AmrLevel::derive (const Vector<std::string>& names, Real time, MultiFab& mf, int dcomp)
+{
+    for (auto const& name : names)
+    {
+        derive(name, time, mf, dcomp);
+
+        int index, scomp;
+        if (isStateVariable(name, index, scomp)) {
+            dcomp += 1;
+        } else {
+            const DeriveRec* rec = derive_lst.get(name);
+            BL_ASSERT(rec != nullptr);
+            dcomp += rec->numDerive();
+        }
+    }
+}
+
+void
+AmrLevel::deriveBatch (const Vector<std::string>& names, Real time, MultiFab& mf, int dcomp)
+{
+    BL_PROFILE("AmrLevel::deriveBatch()");
 
     const int ngrow = mf.nGrow();
 
+    //
+    // A state range needed by several derived quantities is filled once,
+    // with the most ghost cells any of them needs.  Different ranges of
+    // the same state are not merged, because interpolaters such as
+    // CellConservativeLinear couple the components they interpolate.
+    //
+    struct SrcFill {
+        int index, scomp, ncomp, ngrow;
+        std::unique_ptr<MultiFab> mf;
+    };
+    struct DeriveJob {
+        const DeriveRec* rec;
+        int dcomp;
+        int index;
+        int ngrow_src;
+        Vector<int> fills;
+        MultiFab src;
+    };
+    Vector<SrcFill> fills;
+    Vector<DeriveJob> jobs;
+
     int index, scomp, ncomp;
 
-    if (isStateVariable(name,index,scomp))
+    int dc = dcomp;
+    for (auto const& name : names)
     {
-        FillPatch(*this,mf,ngrow,time,index,scomp,1,dcomp);
-    }
-    else if (const DeriveRec* rec = derive_lst.get(name))
-    {
-        rec->getRange(0,index,scomp,ncomp);
-
-        const BoxArray& srcBA = state[index].boxArray();
+        BL_ASSERT(dc < mf.nComp());
 
-        int ngrow_src = ngrow;
+        if (isStateVariable(name,index,scomp))
         {
-            Box bx0 = srcBA[0];
-            Box bx1 = rec->boxMap()(bx0);
-            int g = bx0.smallEnd(0) - bx1.smallEnd(0);
-            ngrow_src += g;
+            FillPatch(*this,mf,ngrow,time,index,scomp,1,dc);
+            ++dc;
         }
+        else if (const DeriveRec* rec = derive_lst.get(name))
+        {
+            rec->getRange(0,index,scomp,ncomp);
 
-        MultiFab srcMF(srcBA,dmap,rec->numState(),ngrow_src, MFInfo(), *m_factory);
+            const BoxArray& srcBA = state[index].boxArray();
 
-        for (int k = 0, dc = 0; k < rec->numRange(); k++, dc += ncomp)
+            int ngrow_src = ngrow;
+            {
+                Box bx0 = srcBA[0];
+                Box bx1 = rec->boxMap()(bx0);
+                int g = bx0.smallEnd(0) - bx1.smallEnd(0);
+                ngrow_src += g;
+            }
+
+            DeriveJob job;
+            job.rec = rec;
+            job.dcomp = dc;
+            job.index = index;
+            job.ngrow_src = ngrow_src;
+            for (int k = 0; k < rec->numRange(); k++)
+            {
+                int idx;
+                rec->getRange(k,idx,scomp,ncomp);
+                auto it = std::find_if(fills.begin(), fills.end(), [&] (SrcFill const& f) {
+                    return f.index == idx && f.scomp == scomp && f.ncomp == ncomp;
+                });
+                if (it == fills.end()) {
+                    fills.push_back(SrcFill{idx, scomp, ncomp, ngrow_src, nullptr});
+                    job.fills.push_back(static_cast<int>(fills.size())-1);
+                } else {
+                    it->ngrow = std::max(it->ngrow, ngrow_src);
+                    job.fills.push_back(static_cast<int>(it - fills.begin()));
+                }
+            }
+            jobs.push_back(std::move(job));
+            dc += rec->numDerive();
+        }
+        else
         {
-            rec->getRange(k,index,scomp,ncomp);
+            //
+            // If we got here, cannot derive given name.
+            //
+            std::string msg("AmrLevel::derive(MultiFab*): unknown variable: ");
+            msg += name;
+            amrex::Error(msg.c_str());
+        }
+    }
 
-            FillPatch(*this,srcMF,ngrow_src,time,index,scomp,ncomp,dc);
+    if (jobs.empty()) return;
+
+    for (auto& f : fills)
+    {
+        f.mf = std::make_unique<MultiFab>(state[f.index].boxArray(),dmap,f.ncomp,f.ngrow,
+                                          MFInfo(), *m_factory);
+        FillPatch(*this,*f.mf,f.ngrow,time,f.index,f.scomp,f.ncomp,0);
+    }
+
+    bool has_fab_func = false;
+    bool has_fort_func = false;
+    for (auto& job : jobs)
+    {
+        const DeriveRec* rec = job.rec;
+        if (rec->numRange() == 1) {
+            MultiFab const& fmf = *fills[job.fills[0]].mf;
+            job.src = MultiFab(fmf, amrex::make_alias, 0, fmf.nComp());
+        } else {
+            job.src.define(state[job.index].boxArray(),dmap,rec->numState(),job.ngrow_src,
+                           MFInfo(), *m_factory);
+            for (int k = 0, sc = 0; k < rec->numRange(); k++)
+            {
+                SrcFill const& f = fills[job.fills[k]];
+                if (f.mf->boxArray() == job.src.boxArray()) {
+                    MultiFab::Copy(job.src,*f.mf,0,sc,f.ncomp,job.ngrow_src);
+                } else {
+                    FillPatch(*this,job.src,job.ngrow_src,time,f.index,f.scomp,f.ncomp,sc);
+                }
+                sc += f.ncomp;
+            }
+        }
+        if (rec->derFuncFab() != nullptr) {
+            has_fab_func = true;
+        } else {
+            has_fort_func = true;
         }
+    }
 
-        if (rec->derFuncFab() != nullptr)
-        {
+    if (has_fab_func)
+    {
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-            for (MFIter mfi(mf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        for (MFIter mfi(mf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.growntilebox();
+            FArrayBox& derfab = mf[mfi];
+            for (auto const& job : jobs)
             {
-                const Box& bx = mfi.growntilebox();
-                FArrayBox& derfab = mf[mfi];
-                FArrayBox const& datafab = srcMF[mfi];
+                const DeriveRec* rec = job.rec;
+                if (rec->derFuncFab() == nullptr) continue;
+                FArrayBox const& datafab = job.src[mfi];
                 const int dncomp = rec->numDerive();
-                rec->derFuncFab()(bx, derfab, dcomp, dncomp, datafab, geom, time, rec->getBC(), level);
+                rec->derFuncFab()(bx, derfab, job.dcomp, dncomp, datafab, geom, time, rec->getBC(), level);
             }
         }
-        else
-        {
+    }
+
+    if (has_fort_func)
+    {
 #ifdef AMREX_USE_OMP
 #pragma omp parallel
 #endif
         for (MFIter mfi(mf,true); mfi.isValid(); ++mfi)
         {
             int         idx     = mfi.index();
-            Real*       ddat    = mf[mfi].dataPtr(dcomp);
             const int*  dlo     = mf[mfi].loVect();
             const int*  dhi     = mf[mfi].hiVect();
             const Box&  gtbx    = mfi.growntilebox();
             const int*  lo      = gtbx.loVect();
             const int*  hi      = gtbx.hiVect();
-            int         n_der   = rec->numDerive();
-            Real*       cdat    = srcMF[mfi].dataPtr();
-            const int*  clo     = srcMF[mfi].loVect();
-            const int*  chi     = srcMF[mfi].hiVect();
-            int         n_state = rec->numState();
-            const int*  dom_lo  = state[index].getDomain().loVect();
-            const int*  dom_hi  = state[index].getDomain().hiVect();
             const Real* dx      = geom.CellSize();
-            const int*  bcr     = rec->getBC();
             const RealBox& temp = RealBox(gtbx,geom.CellSize(),geom.ProbLo());
             const Real* xlo     = temp.lo();
             Real        dt      = parent->dtLevel(level);
 
-            if (rec->derFunc() != static_cast<DeriveFunc>(0)){
-               rec->derFunc()(ddat,AMREX_ARLIM(dlo),AMREX_ARLIM(dhi),&n_der,
-                              cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),&n_state,
-                              lo,hi,dom_lo,dom_hi,dx,xlo,&time,&dt,bcr,
-                              &level,&idx);
-            } else if (rec->derFunc3D() != static_cast<DeriveFunc3D>(0)){
-               const int *bc3D = rec->getBC3D();
-               rec->derFunc3D()(ddat,AMREX_ARLIM_3D(dlo),AMREX_ARLIM_3D(dhi),&n_der,
-                                cdat,AMREX_ARLIM_3D(clo),AMREX_ARLIM_3D(chi),&n_state,
-                                AMREX_ARLIM_3D(lo),AMREX_ARLIM_3D(hi),
-                                AMREX_ARLIM_3D(dom_lo),AMREX_ARLIM_3D(dom_hi),
-                                AMREX_ZFILL(dx),AMREX_ZFILL(xlo),
-                                &time,&dt,
-                                bc3D,
-                                &level,&idx);
-            } else {
-               amrex::Error("AmrLevel::derive: no function available");
+            for (auto const& job : jobs)
+            {
+                const DeriveRec* rec = job.rec;
+                if (rec->derFuncFab() != nullptr) continue;
+
+                Real*       ddat    = mf[mfi].dataPtr(job.dcomp);
+                int         n_der   = rec->numDerive();
+                Real*       cdat    = const_cast<Real*>(job.src[mfi].dataPtr());
+                const int*  clo     = job.src[mfi].loVect();
+                const int*  chi     = job.src[mfi].hiVect();
+                int         n_state = rec->numState();
+                const int*  dom_lo  = state[job.index].getDomain().loVect();
+                const int*  dom_hi  = state[job.index].getDomain().hiVect();
+                const int*  bcr     = rec->getBC();
+
+                if (rec->derFunc() != static_cast<DeriveFunc>(0)){
+                   rec->derFunc()(ddat,AMREX_ARLIM(dlo),AMREX_ARLIM(dhi),&n_der,
+                                  cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),&n_state,
+                                  lo,hi,dom_lo,dom_hi,dx,xlo,&time,&dt,bcr,
+                                  &level,&idx);
+                } else if (rec->derFunc3D() != static_cast<DeriveFunc3D>(0)){
+                   const int *bc3D = rec->getBC3D();
+                   rec->derFunc3D()(ddat,AMREX_ARLIM_3D(dlo),AMREX_ARLIM_3D(dhi),&n_der,
+                                    cdat,AMREX_ARLIM_3D(clo),AMREX_ARLIM_3D(chi),&n_state,
+                                    AMREX_ARLIM_3D(lo),AMREX_ARLIM_3D(hi),
+                                    AMREX_ARLIM_3D(dom_lo),AMREX_ARLIM_3D(dom_hi),
+                                    AMREX_ZFILL(dx),AMREX_ZFILL(xlo),
+                                    &time,&dt,
+                                    bc3D,
+                                    &level,&idx);
+                } else {
+                   amrex::Error("AmrLevel::derive: no function available");
+                }
             }
         }
-        }
-    }
-    else
-    {
-        //
-        // If we got here, cannot derive given name.
-        //
-        std::string msg("AmrLevel::derive(MultiFab*): unknown variable: ");
-        msg += name;
-        amrex::Error(msg.c_str());
     }
 }
 
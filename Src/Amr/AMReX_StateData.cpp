@@ -25,6 +25,7 @@ static constexpr int MFNEWDATA = 0;
 static constexpr int MFOLDDATA = 1;
 
 Vector<std::string> StateData::fabArrayHeaderNames;
+std::atomic<Long> StateData::version_counter{0};
 std::map<std::string, Vector<char> > *StateData::faHeaderMap;
 
 
@@ -57,13 +58,15 @@ StateData::StateData (StateData&& rhs) noexcept
       old_time(rhs.old_time),
       new_data(std::move(rhs.new_data)),
       old_data(std::move(rhs.old_data)),
-      arena(rhs.arena)
+      arena(rhs.arena),
+      m_version(rhs.version())
 {
 }
 
 void
 StateData::operator= (StateData const& rhs)
 {
+    setModified();
     m_factory.reset(rhs.m_factory->clone());
     desc = rhs.desc;
     arena = rhs.arena;
@@ -96,6 +99,7 @@ StateData::define (const Box&             p_domain,
                    const FabFactory<FArrayBox>& factory)
 {
     BL_PROFILE("StateData::define()");
+    setModified();
     domain = p_domain;
     desc = &d;
     arena = nullptr;
@@ -135,6 +139,7 @@ StateData::define (const Box&             p_domain,
 void
 StateData::copyOld (const StateData& state)
 {
+    setModified();
     const MultiFab& MF = state.oldData();
 
     int nc = MF.nComp();
@@ -151,6 +156,7 @@ StateData::copyOld (const StateData& state)
 void
 StateData::copyNew (const StateData& state)
 {
+    setModified();
     const MultiFab& MF = state.newData();
 
     int nc = MF.nComp();
@@ -167,6 +173,7 @@ StateData::copyNew (const StateData& state)
 void
 StateData::reset ()
 {
+    setModified();
     new_time = old_time;
     old_time.start = old_time.stop = INVALID_TIME;
     std::swap(old_data, new_data);
@@ -181,6 +188,7 @@ StateData::restart (std::istream&          is,
                     const StateDescriptor& d,
                     const std::string&     chkfile)
 {
+    setModified();
     desc = &d;
     arena = nullptr;
     domain = p_domain;
@@ -211,6 +219,7 @@ void
 StateData::restartDoit (std::istream& is, const std::string& chkfile)
 {
     BL_PROFILE("StateData::restartDoit()");
+    setModified();
 
     is >> old_time.start;
     is >> old_time.stop;
@@ -281,6 +290,7 @@ void
 StateData::restart (const StateDescriptor& d,
                     const StateData& rhs)
 {
+    setModified();
     desc = &d;
     arena = nullptr;
     domain = rhs.domain;
@@ -304,6 +314,7 @@ StateData::~StateData()
 void
 StateData::allocOldData ()
 {
+    setModified();
     if (old_data == nullptr)
     {
         old_data = std::make_unique<MultiFab>(grids,dmap,desc->nComp(),desc->nExtra(),
@@ -323,6 +334,7 @@ StateData::getBC (int comp, int i) const noexcept
 void
 StateData::setOldTimeLevel (Real time)
 {
+    setModified();
     if (desc->timeType() == StateDescriptor::Point)
     {
         old_time.start = old_time.stop = time;
@@ -336,6 +348,7 @@ StateData::setOldTimeLevel (Real time)
 void
 StateData::setNewTimeLevel (Real time)
 {
+    setModified();
     if (desc->timeType() == StateDescriptor::Point)
     {
         new_time.start = new_time.stop = time;
@@ -349,6 +362,7 @@ StateData::setNewTimeLevel (Real time)
 void
 StateData::syncNewTimeLevel (Real time)
 {
+    setModified();
     Real teps = (new_time.stop - old_time.stop)*1.e-3_rt;
     if (time > new_time.stop-teps && time < new_time.stop+teps)
     {
@@ -368,6 +382,7 @@ StateData::setTimeLevel (Real time,
                          Real dt_old,
                          Real dt_new)
 {
+    setModified();
     if (desc->timeType() == StateDescriptor::Point)
     {
         new_time.start = new_time.stop = time;
@@ -385,6 +400,7 @@ StateData::setTimeLevel (Real time,
 void
 StateData::swapTimeLevels (Real dt)
 {
+    setModified();
     old_time = new_time;
     if (desc->timeType() == StateDescriptor::Point)
     {
@@ -402,6 +418,7 @@ StateData::swapTimeLevels (Real dt)
 void
 StateData::replaceOldData (MultiFab&& mf)
 {
+    setModified();
     old_data = std::make_unique<MultiFab>(std::move(mf));
 }
 
@@ -410,12 +427,15 @@ StateData::replaceOldData (MultiFab&& mf)
 void
 StateData::replaceOldData (StateData& s)
 {
+    setModified();
+    s.setModified();
     MultiFab::Swap(*old_data, *s.old_data, 0, 0, old_data->nComp(), old_data->nGrow());
 }
 
 void
 StateData::replaceNewData (MultiFab&& mf)
 {
+    setModified();
     new_data = std::make_unique<MultiFab>(std::move(mf));
 }
 
@@ -424,6 +444,8 @@ StateData::replaceNewData (MultiFab&& mf)
 void
 StateData::replaceNewData (StateData& s)
 {
+    setModified();
+    s.setModified();
     MultiFab::Swap(*new_data, *s.new_data, 0, 0, new_data->nComp(), new_data->nGrow());
 }
 
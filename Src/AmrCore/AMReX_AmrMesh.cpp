@@ -848,6 +848,126 @@ AmrMesh::MakeNewGrids (Real time)
     }
 }
 
+RegridMetrics
+AmrMesh::RegridDryRun (int lbase, Real time, Long bytes_per_cell)
+{
+    BL_PROFILE("AmrMesh::RegridDryRun()");
+
+    int new_finest = finest_level;
+    Vector<BoxArray> new_grids(max_level+1);
+    if (lbase < std::min(finest_level+1, max_level)) {
+        MakeNewGrids(lbase, time, new_finest, new_grids);
+    }
+    for (int lev = lbase+1; lev <= std::min(finest_level,new_finest); ++lev) {
+        if (new_grids[lev].empty()) new_grids[lev] = grids[lev];
+    }
+
+    return ComputeRegridMetrics(lbase+1, new_finest, new_grids,
+                                Vector<DistributionMapping>(), bytes_per_cell);
+}
+
+RegridMetrics
+AmrMesh::ComputeRegridMetrics (int start, int new_finest,
+                               const Vector<BoxArray>& new_grids,
+                               const Vector<DistributionMapping>& new_dmap,
+                               Long bytes_per_cell) const
+{
+    BL_PROFILE("AmrMesh::ComputeRegridMetrics()");
+
+    const int nlevs = std::max(finest_level,new_finest) + 1;
+    const int nprocs = ParallelDescriptor::NProcs();
+
+    RegridMetrics m;
+    m.start = start;
+    m.new_finest = new_finest;
+    m.grids.resize(nlevs);
+    m.dmap.resize(nlevs);
+    m.old_cells.resize(nlevs, 0);
+    m.new_cells.resize(nlevs, 0);
+    m.overlap_cells.resize(nlevs, 0);
+    m.moved_cells.resize(nlevs, 0);
+    m.moved_bytes.resize(nlevs, 0);
+    m.imbalance.resize(nlevs, Real(1.0));
+
+    std::vector<std::pair<int,Box> > isects;
+    for (int lev = start; lev < nlevs; ++lev)
+    {
+        const bool has_old = lev <= finest_level && !grids[lev].empty();
+        if (has_old) {
+            m.old_cells[lev] = grids[lev].numPts();
+        }
+        if (lev > new_finest) continue;
+
+        const BoxArray& ba = new_grids[lev];
+        m.grids[lev] = ba;
+        if (lev < static_cast<int>(new_dmap.size()) && !new_dmap[lev].empty()) {
+            m.dmap[lev] = new_dmap[lev];
+        } else if (has_old && ba == grids[lev]) {
+            m.dmap[lev] = dmap[lev];
+        } else {
+            m.dmap[lev].define(ba);
+        }
+        const DistributionMapping& dm = m.dmap[lev];
+
+        Vector<Long> load(nprocs, 0);
+        for (int i = 0, N = ba.size(); i < N; ++i)
+        {
+            const Long npts = ba[i].numPts();
+            m.new_cells[lev] += npts;
+            load[dm[i]] += npts;
+            if (has_old) {
+                grids[lev].intersections(ba[i], isects);
+                for (auto const& is : isects) {
+                    const Long n = is.second.numPts();
+                    m.overlap_cells[lev] += n;
+                    if (dmap[lev][is.first] != dm[i]) {
+                        m.moved_cells[lev] += n;
+                    }
+                }
+            }
+        }
+        m.moved_bytes[lev] = m.moved_cells[lev] * bytes_per_cell;
+
+        if (m.new_cells[lev] > 0) {
+            const Real avg = static_cast<Real>(m.new_cells[lev]) / static_cast<Real>(nprocs);
+            m.imbalance[lev] = static_cast<Real>(*std::max_element(load.begin(), load.end())) / avg;
+        }
+    }
+
+    return m;
+}
+
+Real
+RegridMetrics::churn () const noexcept
+{
+    Long changed = 0, total = 0;
+    for (int lev = start; lev < static_cast<int>(old_cells.size()); ++lev) {
+        changed += (old_cells[lev] - overlap_cells[lev]) + (new_cells[lev] - overlap_cells[lev]);
+        total += old_cells[lev] + new_cells[lev];
+    }
+    return (total > 0) ? static_cast<Real>(changed) / static_cast<Real>(total) : Real(0.0);
+}
+
+Long
+RegridMetrics::totalMovedBytes () const noexcept
+{
+    Long r = 0;
+    for (int lev = start; lev < static_cast<int>(moved_bytes.size()); ++lev) {
+        r += moved_bytes[lev];
+    }
+    return r;
+}
+
+Real
+RegridMetrics::maxImbalance () const noexcept
+{
+    Real r = Real(1.0);
+    for (int lev = start; lev < static_cast<int>(imbalance.size()); ++lev) {
+        r = std::max(r, imbalance[lev]);
+    }
+    return r;
+}
+
 void
 AmrMesh::ProjPeriodic (BoxList& blout, const Box& domain,
                        Array<int,AMREX_SPACEDIM> const& is_per)
@@ -1041,4 +1161,21 @@ std::ostream& operator<< (std::ostream& os, AmrMesh const& amr_mesh)
     return os;
 }
 
+std::ostream& operator<< (std::ostream& os, RegridMetrics const& metrics)
+{
+    for (int lev = metrics.start; lev < static_cast<int>(metrics.old_cells.size()); ++lev) {
+        os << "  level " << lev
+           << ": old cells " << metrics.old_cells[lev]
+           << ", new cells " << metrics.new_cells[lev]
+           << ", overlap " << metrics.overlap_cells[lev]
+           << ", moved " << metrics.moved_cells[lev]
+           << " (" << metrics.moved_bytes[lev] << " bytes)"
+           << ", imbalance " << metrics.imbalance[lev] << "\n";
+    }
+    os << "  churn " << metrics.churn()
+       << ", moved bytes " << metrics.totalMovedBytes()
+       << ", max imbalance " << metrics.maxImbalance() << "\n";
+    return os;
+}
+
 }
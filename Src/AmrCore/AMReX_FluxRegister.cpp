@@ -88,10 +88,15 @@ FluxRegister::define (const BoxArray&            fine_boxes,
 void
 FluxRegister::clear ()
 {
+    CrseInit_finish();
+    m_packed_faces.clear();
     BndryRegister::clear();
 }
 
-FluxRegister::~FluxRegister () {}
+FluxRegister::~FluxRegister ()
+{
+    CrseInit_finish();
+}
 
 Real
 FluxRegister::SumReg (int comp) const
@@ -192,37 +197,22 @@ FluxRegister::CrseInit (const MultiFab& mflx,
         });
     }
 
-    for (int pass = 0; pass < 2; pass++)
-    {
-        const Orientation face = ((pass == 0) ? face_lo : face_hi);
+    // Both faces are filled with one ParallelCopy.  With ADD, the fluxes
+    // are copied into zeroed temporaries first, so that a face shared by
+    // two coarse grids is only added once.
+    const PackedFaces& pf = packedFaces((1 << int(face_lo)) | (1 << int(face_hi)), false);
 
-        if (op == FluxRegister::COPY)
-        {
-            bndry[face].copyFrom(mf,0,0,destcomp,numcomp);
-        }
-        else
-        {
-            FabSet fs(bndry[face].boxArray(),bndry[face].DistributionMap(),numcomp);
+    MultiFab packed(pf.ba, pf.dm, numcomp, 0);
 
-            fs.setVal(0);
+    if (op == FluxRegister::COPY) {
+        packFaces(packed, pf, destcomp, numcomp);
+    } else {
+        packed.setVal(0.0);
+    }
 
-            fs.copyFrom(mf,0,0,0,numcomp);
+    packed.ParallelCopy(mf,0,0,numcomp);
 
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-            for (FabSetIter mfi(fs); mfi.isValid(); ++mfi)
-            {
-                const Box& bx = mfi.validbox();
-                auto const sfab = fs.const_array(mfi);
-                auto       dfab = bndry[face].array(mfi);
-                AMREX_HOST_DEVICE_PARALLEL_FOR_4D (bx, numcomp, i, j, k, n,
-                {
-                    dfab(i,j,k,n+destcomp) += sfab(i,j,k,n);
-                });
-            }
-        }
-    }
+    unpackFaces(packed, pf, destcomp, numcomp, op);
 }
 
 void
@@ -245,6 +235,70 @@ FluxRegister::CrseInit (const MultiFab& mflx,
     CrseInit(mflx,area,dir,srccomp,destcomp,numcomp,mult,op);
 }
 
+void
+FluxRegister::CrseInit_nowait (const MultiFab& mflx,
+                               int             dir,
+                               int             srccomp,
+                               int             destcomp,
+                               int             numcomp,
+                               Real            mult)
+{
+    BL_PROFILE("FluxRegister::CrseInit_nowait()");
+
+    BL_ASSERT(srccomp >= 0 && srccomp+numcomp <= mflx.nComp());
+    BL_ASSERT(destcomp >= 0 && destcomp+numcomp <= ncomp);
+
+    auto mf = std::make_unique<MultiFab>(mflx.boxArray(),mflx.DistributionMap(),numcomp,0,
+                                         MFInfo(), mflx.Factory());
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(mflx,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        auto       dfab = mf->array(mfi);
+        auto const sfab = mflx.const_array(mfi);
+        AMREX_HOST_DEVICE_PARALLEL_FOR_4D ( bx, numcomp, i, j, k, n,
+        {
+            dfab(i,j,k,n) = sfab(i,j,k,n+srccomp)*mult;
+        });
+    }
+
+    // The fluxes are copied into zeroed temporaries first, so that a face
+    // shared by two coarse grids is only added once.
+    PendingCrseInit pending;
+    pending.face_mask = (1 << int(Orientation(dir,Orientation::low)))
+        |               (1 << int(Orientation(dir,Orientation::high)));
+    pending.destcomp = destcomp;
+    pending.numcomp = numcomp;
+
+    const PackedFaces& pf = packedFaces(pending.face_mask, false);
+    pending.dst = std::make_unique<MultiFab>(pf.ba, pf.dm, numcomp, 0);
+    pending.dst->setVal(0.0);
+    pending.dst->ParallelCopy_nowait(*mf,0,0,numcomp);
+
+    // Keep the source alive until the copy is finished.
+    pending.src = std::move(mf);
+    m_crse_init_pending.push_back(std::move(pending));
+}
+
+void
+FluxRegister::CrseInit_finish ()
+{
+    if (m_crse_init_pending.empty()) return;
+
+    BL_PROFILE("FluxRegister::CrseInit_finish()");
+
+    for (auto& pending : m_crse_init_pending)
+    {
+        pending.dst->ParallelCopy_finish();
+        unpackFaces(*pending.dst, packedFaces(pending.face_mask, false),
+                    pending.destcomp, pending.numcomp, FluxRegister::ADD);
+    }
+    m_crse_init_pending.clear();
+}
+
 void
 FluxRegister::CrseAdd (const MultiFab& mflx,
                        const MultiFab& area,
@@ -279,11 +333,13 @@ FluxRegister::CrseAdd (const MultiFab& mflx,
         });
     }
 
-    for (int pass = 0; pass < 2; pass++)
-    {
-        const Orientation face = ((pass == 0) ? face_lo : face_hi);
-        bndry[face].plusFrom(mf,0,0,destcomp,numcomp,geom.periodicity());
-    }
+    const PackedFaces& pf = packedFaces((1 << int(face_lo)) | (1 << int(face_hi)), false);
+
+    MultiFab packed(pf.ba, pf.dm, numcomp, 0);
+    packed.setVal(0.0);
+    packed.ParallelAdd(mf,0,0,numcomp,geom.periodicity());
+
+    unpackFaces(packed, pf, destcomp, numcomp, FluxRegister::ADD);
 }
 
 void
@@ -479,11 +535,7 @@ FluxRegister::Reflux (MultiFab&       mf,
                       int             nc,
                       const Geometry& geom)
 {
-    for (OrientationIter fi; fi; ++fi)
-    {
-        const Orientation& face = fi();
-        Reflux(mf, volume, face, scale, scomp, dcomp, nc, geom);
-    }
+    RefluxFaces(mf, volume, (1 << (2*AMREX_SPACEDIM)) - 1, scale, scomp, dcomp, nc, geom);
 }
 
 void
@@ -496,12 +548,9 @@ FluxRegister::Reflux (MultiFab&       mf,
                       int             nc,
                       const Geometry& geom)
 {
-    for (int s = 0; s < 2; ++s)
-    {
-        Orientation::Side side = (s==0) ? Orientation::low : Orientation::high;
-        Orientation face(dir, side);
-        Reflux(mf, volume, face, scale, scomp, dcomp, nc, geom);
-    }
+    const int face_mask = (1 << int(Orientation(dir,Orientation::low)))
+        |                 (1 << int(Orientation(dir,Orientation::high)));
+    RefluxFaces(mf, volume, face_mask, scale, scomp, dcomp, nc, geom);
 }
 
 void
@@ -544,16 +593,27 @@ FluxRegister::Reflux (MultiFab&       mf,
 void
 FluxRegister::Reflux (MultiFab& mf, const MultiFab& volume, Orientation face,
                       Real scale, int scomp, int dcomp, int nc, const Geometry& geom)
+{
+    RefluxFaces(mf, volume, 1 << int(face), scale, scomp, dcomp, nc, geom);
+}
+
+void
+FluxRegister::RefluxFaces (MultiFab& mf, const MultiFab& volume, int face_mask,
+                           Real scale, int scomp, int dcomp, int nc, const Geometry& geom)
 {
     BL_PROFILE("FluxRegister::Reflux()");
 
-    int idir = face.coordDir();
+    // The signed fluxes of all the faces are put in the coarse cells they
+    // correct and summed into corr with one ParallelAdd.  A cell next to
+    // several fine faces gets all of them.
+    const PackedFaces& pf = packedFaces(face_mask, true);
 
-    MultiFab flux(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
-                  mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory());
-    flux.setVal(0.0);
+    MultiFab packed(pf.ba, pf.dm, nc, 0);
+    packFaces(packed, pf, scomp, nc);
 
-    bndry[face].copyTo(flux, 0, scomp, 0, nc, geom.periodicity());
+    MultiFab corr(mf.boxArray(), mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory());
+    corr.setVal(0.0);
+    corr.ParallelAdd(packed, 0, 0, nc, geom.periodicity());
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
@@ -561,16 +621,125 @@ FluxRegister::Reflux (MultiFab& mf, const MultiFab& volume, Orientation face,
     for (MFIter mfi(mf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
-        Array4<Real> const& sfab = mf.array(mfi);
-        Array4<Real const> const& ffab = flux.const_array(mfi);
+        Array4<Real> const& sfab = mf.array(mfi,dcomp);
+        Array4<Real const> const& cfab = corr.const_array(mfi);
         Array4<Real const> const& vfab = volume.const_array(mfi);
-        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (bx, tbx,
+        AMREX_HOST_DEVICE_PARALLEL_FOR_4D (bx, nc, i, j, k, n,
         {
-            fluxreg_reflux(tbx, sfab, dcomp, ffab, vfab, nc, scale, face);
+            sfab(i,j,k,n) += scale*(cfab(i,j,k,n)/vfab(i,j,k));
         });
     }
 }
 
+const FluxRegister::PackedFaces&
+FluxRegister::packedFaces (int face_mask, bool cell_centered)
+{
+    const int key = cell_centered ? (face_mask | (1 << (2*AMREX_SPACEDIM))) : face_mask;
+    auto found = m_packed_faces.find(key);
+    if (found != m_packed_faces.end()) {
+        return found->second;
+    }
+
+    PackedFaces& pf = m_packed_faces[key];
+    pf.cell_centered = cell_centered;
+
+    const int nboxes = grids.size();
+    const Vector<int>& pmap = DistributionMap().ProcessorMap();
+    Vector<int> packed_pmap;
+    BoxList bl;
+    for (OrientationIter fi; fi; ++fi)
+    {
+        const Orientation face = fi();
+        if ((face_mask & (1 << int(face))) == 0) continue;
+
+        pf.faces.push_back(face);
+
+        const BoxArray& fba = bndry[face].boxArray();
+        if (bl.isEmpty()) {
+            bl.set(cell_centered ? IndexType::TheCellType() : fba.ixType());
+        }
+        for (int i = 0; i < nboxes; ++i)
+        {
+            Box b = fba[i];
+            if (cell_centered) {
+                // Same indices, so that face i of a high face becomes cell i.
+                b = Box(b.smallEnd(), b.bigEnd());
+                if (face.isLow()) b.shift(face.coordDir(), -1);
+            }
+            bl.push_back(b);
+        }
+        packed_pmap.insert(packed_pmap.end(), pmap.begin(), pmap.end());
+    }
+
+    pf.ba = BoxArray(std::move(bl));
+    pf.dm = DistributionMapping(std::move(packed_pmap));
+
+    return pf;
+}
+
+void
+FluxRegister::packFaces (MultiFab& packed, const PackedFaces& pf, int srccomp, int numcomp)
+{
+    const int nboxes = grids.size();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(packed); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+        const Orientation face = pf.faces[mfi.index() / nboxes];
+        const int boxno = mfi.index() % nboxes;
+        auto       dfab = packed.array(mfi);
+        auto const sfab = bndry[face][boxno].const_array(srccomp);
+        if (pf.cell_centered && face.isLow()) {
+            // The correction of a low face goes to the cell below it.
+            const Dim3 off = IntVect::TheDimensionVector(face.coordDir()).dim3();
+            AMREX_HOST_DEVICE_PARALLEL_FOR_4D (bx, numcomp, i, j, k, n,
+            {
+                dfab(i,j,k,n) = -sfab(i+off.x,j+off.y,k+off.z,n);
+            });
+        } else {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_4D (bx, numcomp, i, j, k, n,
+            {
+                dfab(i,j,k,n) = sfab(i,j,k,n);
+            });
+        }
+    }
+}
+
+void
+FluxRegister::unpackFaces (const MultiFab& packed, const PackedFaces& pf, int destcomp,
+                           int numcomp, FrOp op)
+{
+    BL_ASSERT(!pf.cell_centered);
+
+    const int nboxes = grids.size();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(packed); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+        const Orientation face = pf.faces[mfi.index() / nboxes];
+        const int boxno = mfi.index() % nboxes;
+        auto const sfab = packed.const_array(mfi);
+        auto       dfab = bndry[face][boxno].array(destcomp);
+        if (op == FluxRegister::COPY) {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_4D (bx, numcomp, i, j, k, n,
+            {
+                dfab(i,j,k,n) = sfab(i,j,k,n);
+            });
+        } else {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_4D (bx, numcomp, i, j, k, n,
+            {
+                dfab(i,j,k,n) += sfab(i,j,k,n);
+            });
+        }
+    }
+}
+
 void
 FluxRegister::ClearInternalBorders (const Geometry& geom)
 {
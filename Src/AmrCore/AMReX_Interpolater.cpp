@@ -532,11 +532,27 @@ CellConservativeLinear::interp (const FArrayBox& crse,
             });
         }
 
-        AMREX_HOST_DEVICE_PARALLEL_FOR_4D_FLAG(runon, fine_region, ncomp, i, j, k, n,
-        {
-            mf_cell_cons_lin_interp(i,j,k,n, finearr, fine_comp, ctmp,
-                                    crsearr, crse_comp, ncomp, ratio);
-        });
+        // On the CPU each coarse cell does all of its fine cells.  On the
+        // GPU one thread per fine cell exposes more parallelism.
+        if (ratio == 2 && !run_on_gpu) {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_4D_FLAG(runon, cslope_bx, ncomp, ic, jc, kc, n,
+            {
+                mf_cell_cons_lin_interp_rr<2>(ic,jc,kc,n, finearr, fine_comp, ctmp,
+                                              crsearr, crse_comp, ncomp, fine_region);
+            });
+        } else if (ratio == 4 && !run_on_gpu) {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_4D_FLAG(runon, cslope_bx, ncomp, ic, jc, kc, n,
+            {
+                mf_cell_cons_lin_interp_rr<4>(ic,jc,kc,n, finearr, fine_comp, ctmp,
+                                              crsearr, crse_comp, ncomp, fine_region);
+            });
+        } else {
+            AMREX_HOST_DEVICE_PARALLEL_FOR_4D_FLAG(runon, fine_region, ncomp, i, j, k, n,
+            {
+                mf_cell_cons_lin_interp(i,j,k,n, finearr, fine_comp, ctmp,
+                                        crsearr, crse_comp, ncomp, ratio);
+            });
+        }
     }
 }
 
@@ -857,11 +873,29 @@ CellConservativeQuartic::interp (const FArrayBox&  crse,
     Array4<Real const> const& crsearr = crse.const_array(crse_comp);
     Array4<Real>       const& finearr = fine.array(fine_comp);
 
-    AMREX_HOST_DEVICE_PARALLEL_FOR_4D_FLAG(runon, target_fine_region, ncomp, i, j, k, n,
+    bool run_on_gpu = (runon == RunOn::Gpu && Gpu::inLaunchRegion());
+
+    // On the GPU one thread per fine cell exposes more parallelism.
+    if (run_on_gpu)
     {
-        ccquartic_interp(i, j, k, n,
-                         crsearr, finearr);
-    });
+        AMREX_HOST_DEVICE_PARALLEL_FOR_4D_FLAG(runon, target_fine_region, ncomp, i, j, k, n,
+        {
+            ccquartic_interp(i, j, k, n,
+                             crsearr, finearr);
+        });
+    }
+    else
+    {
+        // Each coarse cell does all of its fine cells, sharing the work of
+        // the passes in the slower directions.
+        const Box& target_crse_region = amrex::coarsen(target_fine_region,2);
+
+        AMREX_HOST_DEVICE_PARALLEL_FOR_4D_FLAG(runon, target_crse_region, ncomp, ic, jc, kc, n,
+        {
+            ccquartic_interp_children(ic, jc, kc, n,
+                                      crsearr, finearr, target_fine_region);
+        });
+    }
 }
 
 FaceDivFree::~FaceDivFree () {}
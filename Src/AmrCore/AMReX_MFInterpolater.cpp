@@ -286,12 +286,28 @@ MFCellConsLinInterp::interp (MultiFab const& crsemf, int ccomp, MultiFab& finemf
                         });
                     }
 
-                    amrex::LoopConcurrentOnCpu(fbox, nc,
-                    [&] (int i, int j, int k, int n) noexcept
-                    {
-                        mf_cell_cons_lin_interp(i,j,k,n, fine, fcomp, ctmp,
-                                                crse, ccomp, nc, ratio);
-                    });
+                    if (ratio == 2) {
+                        amrex::LoopConcurrentOnCpu(amrex::coarsen(fbox,2), nc,
+                        [&] (int ic, int jc, int kc, int n) noexcept
+                        {
+                            mf_cell_cons_lin_interp_rr<2>(ic,jc,kc,n, fine, fcomp, ctmp,
+                                                          crse, ccomp, nc, fbox);
+                        });
+                    } else if (ratio == 4) {
+                        amrex::LoopConcurrentOnCpu(amrex::coarsen(fbox,4), nc,
+                        [&] (int ic, int jc, int kc, int n) noexcept
+                        {
+                            mf_cell_cons_lin_interp_rr<4>(ic,jc,kc,n, fine, fcomp, ctmp,
+                                                          crse, ccomp, nc, fbox);
+                        });
+                    } else {
+                        amrex::LoopConcurrentOnCpu(fbox, nc,
+                        [&] (int i, int j, int k, int n) noexcept
+                        {
+                            mf_cell_cons_lin_interp(i,j,k,n, fine, fcomp, ctmp,
+                                                    crse, ccomp, nc, ratio);
+                        });
+                    }
                 }
             }
         }
@@ -8,11 +8,219 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
 #include <climits>
 
 namespace amrex {
 
+namespace {
+
+int tagbits_popcount (std::uint64_t x) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Append a run of tags, merging it with the last one if they touch.
+void add_tag_run (Vector<int>& runs, IntVect const& lo, int len)
+{
+    constexpr int N = AMREX_SPACEDIM+1;
+    if (!runs.empty()) {
+        int* last = runs.data() + runs.size() - N;
+        bool touch = last[0] + last[AMREX_SPACEDIM] == lo[0];
+        for (int idim = 1; idim < AMREX_SPACEDIM; ++idim) {
+            touch = touch && (last[idim] == lo[idim]);
+        }
+        if (touch) {
+            last[AMREX_SPACEDIM] += len;
+            return;
+        }
+    }
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        runs.push_back(lo[idim]);
+    }
+    runs.push_back(len);
+}
+
+}
+
+TagBitBox::TagBitBox (const Box& bx)
+    : m_box(bx)
+{
+    if (bx.ok()) {
+        m_len = bx.length(0);
+        m_nwords = (m_len + nbits - 1) / nbits;
+        m_nrows = bx.numPts() / m_len;
+        m_bits.resize(m_nrows*m_nwords, Word(0));
+    }
+}
+
+TagBitBox::TagBitBox (const TagBox& tb, const Box& region, bool only_set)
+    : TagBitBox(tb.box())
+{
+    BL_ASSERT(!region.ok() || m_box.contains(region));
+    if (!region.ok()) return;
+
+    Array4<char const> const& a = tb.const_array();
+    const auto lo = amrex::lbound(m_box);
+    const auto rlo = amrex::lbound(region);
+    const auto rhi = amrex::ubound(region);
+    const int ny = amrex::ubound(m_box).y - lo.y + 1;
+    for (int k = rlo.z; k <= rhi.z; ++k) {
+    for (int j = rlo.y; j <= rhi.y; ++j) {
+        Word* p = row((j-lo.y) + Long(k-lo.z)*ny);
+        const char* c = a.ptr(rlo.x,j,k);
+        const int ioff = rlo.x - lo.x;
+        const int iend = rhi.x - lo.x + 1;
+        for (int w = ioff/nbits; w*nbits < iend; ++w)
+        {
+            const int b0 = std::max(w*nbits, ioff);
+            const int b1 = std::min((w+1)*nbits, iend);
+            const char* cw = c + (b0 - ioff);
+            Word x = 0;
+            for (int b = b0; b < b1; b += 8, cw += 8) {
+                // Skip eight untagged cells at a time.
+                if (b+8 <= b1) {
+                    std::uint64_t eight;
+                    std::memcpy(&eight, cw, sizeof(eight));
+                    if (eight == 0) continue;
+                }
+                for (int bb = 0, nb = std::min(8, b1-b); bb < nb; ++bb) {
+                    const bool t = only_set ? (cw[bb] == TagBox::SET)
+                                            : (cw[bb] != TagBox::CLEAR);
+                    x |= Word(t) << (b - w*nbits + bb);
+                }
+            }
+            p[w] |= x;
+        }
+    }}
+}
+
+Long
+TagBitBox::numTags () const noexcept
+{
+    Long n = 0;
+    for (auto w : m_bits) {
+        n += tagbits_popcount(w);
+    }
+    return n;
+}
+
+void
+TagBitBox::dilate (const IntVect& nbuf)
+{
+    if (m_bits.empty()) return;
+
+    // Along x, shift and or a word at a time.
+    if (nbuf[0] > 0)
+    {
+        const int rem = m_len % nbits;
+        const Word lastmask = (rem == 0) ? ~Word(0) : ((Word(1) << rem) - 1);
+        Vector<Word> tmp(m_nwords);
+        for (Long r = 0; r < m_nrows; ++r)
+        {
+            Word* p = row(r);
+            for (int n = 0; n < nbuf[0]; ++n) {
+                std::copy(p, p+m_nwords, tmp.begin());
+                for (int w = 0; w < m_nwords; ++w) {
+                    Word x = tmp[w] | (tmp[w] << 1) | (tmp[w] >> 1);
+                    if (w > 0)          { x |= tmp[w-1] >> (nbits-1); }
+                    if (w < m_nwords-1) { x |= tmp[w+1] << (nbits-1); }
+                    p[w] = x;
+                }
+                p[m_nwords-1] &= lastmask;
+            }
+        }
+    }
+
+    // Along y and z, or whole rows.
+    Long stride = 1;
+    for (int idim = 1; idim < AMREX_SPACEDIM; ++idim)
+    {
+        const int len = m_box.length(idim);
+        if (nbuf[idim] > 0)
+        {
+            const Vector<Word> src = m_bits;
+            for (Long r = 0; r < m_nrows; ++r)
+            {
+                const int c = static_cast<int>((r / stride) % len);
+                const int cmin = std::max(c-nbuf[idim], 0);
+                const int cmax = std::min(c+nbuf[idim], len-1);
+                Word* p = row(r);
+                for (int cc = cmin; cc <= cmax; ++cc) {
+                    if (cc == c) continue;
+                    const Word* q = src.data() + (r + (cc-c)*stride)*m_nwords;
+                    for (int w = 0; w < m_nwords; ++w) {
+                        p[w] |= q[w];
+                    }
+                }
+            }
+        }
+        stride *= len;
+    }
+}
+
+TagBitBox
+TagBitBox::coarsen (const IntVect& ratio, const Box& cbox) const
+{
+    TagBitBox cbits(cbox);
+    if (m_bits.empty() || !cbox.ok()) return cbits;
+
+    const auto flo = amrex::lbound(m_box);
+    const auto fhi = amrex::ubound(m_box);
+    const auto clo = amrex::lbound(cbox);
+    const auto chi = amrex::ubound(cbox);
+    const Dim3 r = ratio.dim3();
+    const int fny = fhi.y - flo.y + 1;
+    const int cny = chi.y - clo.y + 1;
+
+    Vector<Word> tmp(m_nwords);
+    for (int k = clo.z; k <= chi.z; ++k) {
+    for (int j = clo.y; j <= chi.y; ++j) {
+        // The or of the fine rows in this coarse row.
+        std::fill(tmp.begin(), tmp.end(), Word(0));
+        bool any = false;
+        const int kmin = std::max(k*r.z, flo.z), kmax = std::min(k*r.z+r.z-1, fhi.z);
+        const int jmin = std::max(j*r.y, flo.y), jmax = std::min(j*r.y+r.y-1, fhi.y);
+        for (int kk = kmin; kk <= kmax; ++kk) {
+        for (int jj = jmin; jj <= jmax; ++jj) {
+            const Word* q = row((jj-flo.y) + Long(kk-flo.z)*fny);
+            for (int w = 0; w < m_nwords; ++w) {
+                tmp[w] |= q[w];
+                any = any || (q[w] != Word(0));
+            }
+        }}
+        if (!any) continue;
+
+        Word* p = cbits.row((j-clo.y) + Long(k-clo.z)*cny);
+        for (int i = clo.x; i <= chi.x; ++i) {
+            const int imin = std::max(i*r.x, flo.x) - flo.x;
+            const int imax = std::min(i*r.x+r.x-1, fhi.x) - flo.x;
+            bool t = false;
+            for (int w = imin/nbits; w <= imax/nbits && !t && imin <= imax; ++w) {
+                const int b0 = (w == imin/nbits) ? imin%nbits : 0;
+                const int b1 = (w == imax/nbits) ? imax%nbits : nbits-1;
+                const Word mask = (b1-b0 == nbits-1) ? ~Word(0)
+                    : (((Word(1) << (b1-b0+1)) - 1) << b0);
+                t = (tmp[w] & mask) != Word(0);
+            }
+            if (t) {
+                const int ii = i - clo.x;
+                p[ii/nbits] |= Word(1) << (ii%nbits);
+            }
+        }
+    }}
+
+    return cbits;
+}
+
 TagBox::TagBox () noexcept {}
 
 TagBox::TagBox (Arena* ar) noexcept
@@ -35,6 +243,23 @@ void
 TagBox::coarsen (const IntVect& ratio, const Box& cbox) noexcept
 {
     BL_ASSERT(nComp() == 1);
+
+    if (Gpu::notInLaunchRegion())
+    {
+        const TagBitBox cbits = TagBitBox(*this, domain, false).coarsen(ratio, cbox);
+        std::memset(this->dataPtr(), TagBox::CLEAR, sizeof(TagType)*cbox.numPts());
+        this->domain = cbox;
+        Array4<char> const& carr = this->array();
+        cbits.forEachRun([&] (IntVect const& lo, int len)
+        {
+            const Dim3 c = lo.dim3();
+            for (int n = 0; n < len; ++n) {
+                carr(c.x+n,c.y,c.z) = TagBox::BUF;
+            }
+        });
+        return;
+    }
+
     Array4<char const> const& farr = this->const_array();
 
     TagBox cfab(cbox, 1, The_Arena());
@@ -78,10 +303,10 @@ void
 TagBox::buffer (const IntVect& a_nbuff, const IntVect& a_nwid) noexcept
 {
     Box const& interior = amrex::grow(domain, -a_nwid);
-    Dim3 nbuf = a_nbuff.dim3();
     Array4<char> const& a = this->array();
 #ifdef AMREX_USE_GPU
     if (Gpu::inLaunchRegion()) {
+        Dim3 nbuf = a_nbuff.dim3();
         Box const& interiorplusbuf = amrex::grow(interior, a_nbuff);
         const auto lo = amrex::lbound(interiorplusbuf);
         const auto hi = amrex::ubound(interiorplusbuf);
@@ -108,14 +333,15 @@ TagBox::buffer (const IntVect& a_nbuff, const IntVect& a_nwid) noexcept
     } else
 #endif
     {
-        AMREX_LOOP_3D(interior, i, j, k,
+        // Dilate the SET cells of interior a word at a time.
+        TagBitBox bits(*this, interior, true);
+        bits.dilate(a_nbuff);
+        bits.forEachRun([&] (IntVect const& lo, int len)
         {
-            if (a(i,j,k) == TagBox::SET) {
-                for (int kk = k-nbuf.z; kk <= k+nbuf.z; ++kk) {
-                for (int jj = j-nbuf.y; jj <= j+nbuf.y; ++jj) {
-                for (int ii = i-nbuf.x; ii <= i+nbuf.x; ++ii) {
-                    if (a(ii,jj,kk) == TagBox::CLEAR) { a(ii,jj,kk) = TagBox::BUF; }
-                }}}
+            const Dim3 c = lo.dim3();
+            for (int n = 0; n < len; ++n) {
+                char& t = a(c.x+n,c.y,c.z);
+                if (t == TagBox::CLEAR) { t = TagBox::BUF; }
             }
         });
     }
@@ -378,48 +604,45 @@ TagBoxArray::mapPeriodicRemoveDuplicates (const Geometry& geom)
 void
 TagBoxArray::local_collate_cpu (Gpu::PinnedVector<IntVect>& v) const
 {
-    if (this->local_size() == 0) return;
+    Vector<int> runs;
+    local_collate_runs(runs);
 
-    Vector<int> count(this->local_size());
-#ifdef AMREX_USE_OMP
-#pragma omp parallel
-#endif
-    for (MFIter fai(*this); fai.isValid(); ++fai)
-    {
-        Array4<char const> const& arr = this->const_array(fai);
-        Box const& bx = fai.fabbox();
-        int c = 0;
-        AMREX_LOOP_3D(bx,i,j,k,
-        {
-            if (arr(i,j,k) != TagBox::CLEAR) ++c;
-        });
-        count[fai.LocalIndex()] = c;
+    constexpr int N = AMREX_SPACEDIM+1;
+    Long ntags = 0;
+    for (Long r = 0, nr = runs.size()/N; r < nr; ++r) {
+        ntags += runs[r*N+AMREX_SPACEDIM];
     }
+    v.resize(ntags);
+
+    IntVect* p = v.data();
+    for (Long r = 0, nr = runs.size()/N; r < nr; ++r) {
+        IntVect iv(&runs[r*N]);
+        for (int n = 0; n < runs[r*N+AMREX_SPACEDIM]; ++n) {
+            *p++ = iv;
+            ++iv[0];
+        }
+    }
+}
 
-    Vector<int> offset(count.size()+1, 0);
-    std::partial_sum(count.begin(), count.end(), offset.begin()+1);
-
-    v.resize(offset.back());
-
-    if (v.empty()) return;
+void
+TagBoxArray::local_collate_runs (Vector<int>& runs) const
+{
+    runs.clear();
+    if (this->local_size() == 0) return;
 
+    Vector<Vector<int> > fab_runs(this->local_size());
 #ifdef AMREX_USE_OMP
 #pragma omp parallel
 #endif
     for (MFIter fai(*this); fai.isValid(); ++fai)
     {
-        int li = fai.LocalIndex();
-        if (count[li] > 0) {
-            IntVect* p = v.data() + offset[li];
-            Array4<char const> const& arr = this->const_array(fai);
-            Box const& bx = fai.fabbox();
-            AMREX_LOOP_3D(bx,i,j,k,
-            {
-                if (arr(i,j,k) != TagBox::CLEAR) {
-                    *p++ = IntVect(AMREX_D_DECL(i,j,k));
-                }
-            });
-        }
+        const TagBitBox bits((*this)[fai], fai.fabbox(), false);
+        auto& r = fab_runs[fai.LocalIndex()];
+        bits.forEachRun([&] (IntVect const& lo, int len) { add_tag_run(r, lo, len); });
+    }
+
+    for (auto const& r : fab_runs) {
+        runs.insert(runs.end(), r.begin(), r.end());
     }
 }
 
@@ -598,17 +821,29 @@ TagBoxArray::collate (Gpu::PinnedVector<IntVect>& TheGlobalCollateSpace) const
 {
     BL_PROFILE("TagBoxArray::collate()");
 
-    Gpu::PinnedVector<IntVect> TheLocalCollateSpace;
+    //
+    // The local tags are sent as runs along x, which is usually much
+    // less data than one IntVect per tag.
+    //
+    constexpr int N = AMREX_SPACEDIM+1;
+    Vector<int> TheLocalRuns;
 #ifdef AMREX_USE_GPU
     if (Gpu::inLaunchRegion()) {
+        Gpu::PinnedVector<IntVect> TheLocalCollateSpace;
         local_collate_gpu(TheLocalCollateSpace);
+        for (auto const& iv : TheLocalCollateSpace) {
+            add_tag_run(TheLocalRuns, iv, 1);
+        }
     } else
 #endif
     {
-        local_collate_cpu(TheLocalCollateSpace);
+        local_collate_runs(TheLocalRuns);
     }
 
-    Long count = TheLocalCollateSpace.size();
+    Long count = 0;
+    for (Long r = 0, nr = TheLocalRuns.size()/N; r < nr; ++r) {
+        count += TheLocalRuns[r*N+AMREX_SPACEDIM];
+    }
 
     //
     // The total number of tags system wide that must be collated.
@@ -626,37 +861,50 @@ TagBoxArray::collate (Gpu::PinnedVector<IntVect>& TheGlobalCollateSpace) const
 
 #ifdef BL_USE_MPI
     //
-    // On I/O proc. this holds all tags after they've been gather'd.
-    // On other procs. non-mempty signals size is not zero.
-    //
-    if (ParallelDescriptor::IOProcessor()) {
-        TheGlobalCollateSpace.resize(numtags);
-    } else {
-        TheGlobalCollateSpace.resize(1);
-    }
-
-    //
-    // Tell root CPU how many tags each CPU will be sending.
+    // Tell root CPU how many runs each CPU will be sending.
     //
     const int IOProcNumber = ParallelDescriptor::IOProcessorNumber();
-    const std::vector<int>& countvec = ParallelDescriptor::Gather(static_cast<int>(count),
-                                                                  IOProcNumber);
+    const int nints = static_cast<int>(TheLocalRuns.size());
+    const std::vector<int>& countvec = ParallelDescriptor::Gather(nints, IOProcNumber);
     std::vector<int> offset(countvec.size(),0);
+    Long totalints = 0;
     if (ParallelDescriptor::IOProcessor()) {
-        for (int i = 1, N = offset.size(); i < N; i++) {
+        for (int i = 1, Nc = offset.size(); i < Nc; i++) {
             offset[i] = offset[i-1] + countvec[i-1];
         }
+        totalints = offset.back() + countvec.back();
     }
     //
-    // Gather all the tags to IOProcNumber into TheGlobalCollateSpace.
+    // Gather all the runs to IOProcNumber.
     //
-    const IntVect* psend = (count > 0) ? TheLocalCollateSpace.data() : nullptr;
-    IntVect* precv = TheGlobalCollateSpace.data();
-    ParallelDescriptor::Gatherv(psend, count, precv, countvec, offset, IOProcNumber);
+    Vector<int> TheGlobalRuns(std::max(totalints, Long(1)));
+    const int* psend = (nints > 0) ? TheLocalRuns.data() : nullptr;
+    ParallelDescriptor::Gatherv(psend, nints, TheGlobalRuns.data(), countvec, offset, IOProcNumber);
 
+    //
+    // On I/O proc. this holds all tags after they've been gather'd.
+    // On other procs. non-mempty signals size is not zero.
+    //
+    if (ParallelDescriptor::IOProcessor()) {
+        TheGlobalCollateSpace.resize(numtags);
+    } else {
+        TheGlobalCollateSpace.resize(1);
+        return;
+    }
 #else
-    TheGlobalCollateSpace = std::move(TheLocalCollateSpace);
+    Vector<int> TheGlobalRuns = std::move(TheLocalRuns);
+    TheGlobalCollateSpace.resize(numtags);
+    const Long totalints = TheGlobalRuns.size();
 #endif
+
+    IntVect* p = TheGlobalCollateSpace.data();
+    for (Long r = 0, nr = totalints/N; r < nr; ++r) {
+        IntVect iv(&TheGlobalRuns[r*N]);
+        for (int n = 0; n < TheGlobalRuns[r*N+AMREX_SPACEDIM]; ++n) {
+            *p++ = iv;
+            ++iv[0];
+        }
+    }
 }
 
 void
@@ -505,6 +505,25 @@ namespace amrex
                        int scomp, int ncomp, const IntVect& ratio)
     {
         BL_PROFILE("amrex::average_down");
+        AverageDownHandle handle;
+        average_down_nowait(S_fine, S_crse, scomp, ncomp, ratio, handle);
+        average_down_finish(handle);
+    }
+
+    AverageDownHandle average_down_nowait (const MultiFab& S_fine, MultiFab& S_crse,
+                                           int scomp, int ncomp, const IntVect& ratio)
+    {
+        AverageDownHandle handle;
+        average_down_nowait(S_fine, S_crse, scomp, ncomp, ratio, handle);
+        return handle;
+    }
+
+    void average_down_nowait (const MultiFab& S_fine, MultiFab& S_crse,
+                              int scomp, int ncomp, const IntVect& ratio,
+                              AverageDownHandle& handle)
+    {
+        BL_PROFILE("amrex::average_down_nowait");
+        AMREX_ALWAYS_ASSERT(!handle.isPending());
         AMREX_ASSERT(S_crse.nComp() == S_fine.nComp());
         AMREX_ASSERT((S_crse.is_cell_centered() && S_fine.is_cell_centered()) ||
                      (S_crse.is_nodal()         && S_fine.is_nodal()));
@@ -565,7 +584,8 @@ namespace amrex
         }
         else
         {
-            MultiFab crse_S_fine(crse_S_fine_BA, S_fine.DistributionMap(), ncomp, 0, MFInfo(), FArrayBoxFactory());
+            MultiFab& crse_S_fine = handle.coarsenedTemp(0, crse_S_fine_BA, S_fine.DistributionMap(),
+                                                         ncomp, 0);
 
 #ifdef AMREX_USE_GPU
             if (Gpu::inLaunchRegion() && crse_S_fine.isFusingCandidate()) {
@@ -616,10 +636,42 @@ namespace amrex
                 }
             }
 
-            S_crse.ParallelCopy(crse_S_fine,0,scomp,ncomp);
+            S_crse.ParallelCopy_nowait(crse_S_fine,0,scomp,ncomp);
+            handle.addPending(S_crse);
         }
    }
 
+    void average_down_finish (AverageDownHandle& handle)
+    {
+        BL_PROFILE("amrex::average_down_finish");
+        handle.finish();
+    }
+
+    MultiFab&
+    AverageDownHandle::coarsenedTemp (int i, const BoxArray& ba, const DistributionMapping& dm,
+                                      int ncomp, int ngrow)
+    {
+        if (i >= static_cast<int>(m_tmp.size())) {
+            m_tmp.resize(i+1);
+        }
+        auto& tmp = m_tmp[i];
+        if (!tmp || tmp->boxArray() != ba || tmp->DistributionMap() != dm
+                 || tmp->nComp() != ncomp || tmp->nGrow() != ngrow)
+        {
+            tmp = std::make_unique<MultiFab>(ba, dm, ncomp, ngrow, MFInfo(), FArrayBoxFactory());
+        }
+        return *tmp;
+    }
+
+    void
+    AverageDownHandle::finish ()
+    {
+        for (auto* crse : m_crse) {
+            crse->ParallelCopy_finish();
+        }
+        m_crse.clear();
+    }
+
 // *************************************************************************************************************
 
     void average_down_faces (const Vector<const MultiFab*>& fine,
@@ -717,9 +769,37 @@ namespace amrex
                              const Array<MultiFab*,AMREX_SPACEDIM>& crse,
                              const IntVect& ratio, const Geometry& crse_geom)
     {
+        // The copies of all the directions are in flight at the same time.
+        AverageDownHandle handle;
+        average_down_faces_nowait(fine, crse, ratio, crse_geom, handle);
+        average_down_finish(handle);
+    }
+
+    AverageDownHandle average_down_faces_nowait (const Array<const MultiFab*,AMREX_SPACEDIM>& fine,
+                                                 const Array<MultiFab*,AMREX_SPACEDIM>& crse,
+                                                 const IntVect& ratio, const Geometry& crse_geom)
+    {
+        AverageDownHandle handle;
+        average_down_faces_nowait(fine, crse, ratio, crse_geom, handle);
+        return handle;
+    }
+
+    void average_down_faces_nowait (const Array<const MultiFab*,AMREX_SPACEDIM>& fine,
+                                    const Array<MultiFab*,AMREX_SPACEDIM>& crse,
+                                    const IntVect& ratio, const Geometry& crse_geom,
+                                    AverageDownHandle& handle)
+    {
+        BL_PROFILE("amrex::average_down_faces_nowait");
+        AMREX_ALWAYS_ASSERT(!handle.isPending());
         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
         {
-            average_down_faces(*fine[idim], *crse[idim], ratio, crse_geom);
+            const int ncomp = crse[idim]->nComp();
+            MultiFab& ctmp = handle.coarsenedTemp(idim, amrex::coarsen(fine[idim]->boxArray(),ratio),
+                                                  fine[idim]->DistributionMap(), ncomp, 0);
+            average_down_faces(*fine[idim], ctmp, ratio, 0);
+            crse[idim]->ParallelCopy_nowait(ctmp,0,0,ncomp,IntVect(0),IntVect(0),
+                                            crse_geom.periodicity());
+            handle.addPending(*crse[idim]);
         }
     }
 
@@ -33,11 +33,17 @@ void
 HypreABecLap::solve(MultiFab& soln, const MultiFab& rhs, Real reltol, Real abstol,
                     int maxiter, const BndryData& bndry, int max_bndry_order)
 {
-    if (solver == NULL || m_bndry != &bndry || m_maxorder != max_bndry_order)
+    if (solver == NULL || m_bndry != &bndry || m_maxorder != max_bndry_order || m_coeffs_changed)
     {
         m_bndry = &bndry;
         m_maxorder = max_bndry_order;
+        m_coeffs_changed = false;
         m_factory = &(rhs.Factory());
+        if (solver != NULL) {
+            HYPRE_StructPFMGDestroy(solver);
+            HYPRE_StructMatrixDestroy(A);
+            HYPRE_StructGridDestroy(grid);
+        }
         prepareSolver();
     }
     else
@@ -38,11 +38,19 @@ void
 HypreABecLap2::solve (MultiFab& soln, const MultiFab& rhs, Real reltol, Real abstol,
                       int maxiter, const BndryData& bndry, int max_bndry_order)
 {
-    if (solver == NULL || m_bndry != &bndry || m_maxorder != max_bndry_order)
+    if (solver == NULL || m_bndry != &bndry || m_maxorder != max_bndry_order || m_coeffs_changed)
     {
         m_bndry = &bndry;
         m_maxorder = max_bndry_order;
+        m_coeffs_changed = false;
         m_factory = &(rhs.Factory());
+        if (solver != NULL) {
+            HYPRE_BoomerAMGDestroy(solver);
+            HYPRE_SStructMatrixDestroy(A);
+            HYPRE_SStructGraphDestroy(graph);
+            HYPRE_SStructStencilDestroy(stencil);
+            HYPRE_SStructGridDestroy(hgrid);
+        }
         prepareSolver();
     }
     else
@@ -33,10 +33,11 @@ HypreABecLap3::solve (MultiFab& soln, const MultiFab& rhs, Real rel_tol, Real ab
 {
     BL_PROFILE("HypreABecLap3::solve()");
 
-    if (!hypre_ij || m_bndry != &bndry || m_maxorder != max_bndry_order)
+    if (!hypre_ij || m_bndry != &bndry || m_maxorder != max_bndry_order || m_coeffs_changed)
     {
         m_bndry = &bndry;
         m_maxorder = max_bndry_order;
+        m_coeffs_changed = false;
         m_factory = &(rhs.Factory());
         prepareSolver();
     }
@@ -0,0 +1,313 @@
+
+#include <AMReX_GMRES_MLMG.H>
+#include <AMReX_MLMG.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_ParallelReduce.H>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <string>
+
+namespace amrex {
+
+GMRESMLMG::GMRESMLMG (MLMG& a_mlmg)
+    : m_mlmg(a_mlmg)
+{}
+
+void
+GMRESMLMG::prepare (const Vector<MultiFab*>& a_sol)
+{
+    BL_PROFILE("GMRESMLMG::prepare()");
+
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m_mlmg.getCFStrategy() != MLMG::CFStrategy::ghostnodes,
+                                     "GMRESMLMG does not support CFStrategy::ghostnodes");
+
+    MLLinOp& linop = m_mlmg.getLinOp();
+    m_namrlevs = m_mlmg.numAMRLevels();
+    m_ncomp = linop.getNComp();
+    m_ng_sol = IntVect(1);
+    if (linop.hasHiddenDimension()) m_ng_sol[linop.hiddenDirection()] = 0;
+
+    AMREX_ASSERT(m_namrlevs <= a_sol.size());
+
+    auto make = [&] (Vector<MultiFab>& mfs, IntVect const& ng)
+    {
+        mfs.clear();
+        mfs.resize(m_namrlevs);
+        for (int alev = 0; alev < m_namrlevs; ++alev) {
+            mfs[alev].define(a_sol[alev]->boxArray(), a_sol[alev]->DistributionMap(),
+                             m_ncomp, ng, MFInfo(), *linop.Factory(alev));
+        }
+    };
+
+    const int m = std::max(m_restart, 1);
+    m_v.clear();
+    m_v.resize(m+1);
+    m_z.clear();
+    m_z.resize(m);
+    for (auto& v : m_v) make(v, IntVect(0));
+    for (auto& z : m_z) make(z, m_ng_sol);
+    make(m_w, IntVect(0));
+    make(m_tmp, IntVect(0));
+
+    // The boundary term is L(0).  Subtracting it from L(x) gives the
+    // homogeneous operator Krylov methods need.
+    make(m_bc_term, IntVect(0));
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        m_z[0][alev].setVal(0.0);
+    }
+    m_mlmg.apply(GetVecOfPtrs(m_bc_term), GetVecOfPtrs(m_z[0]));
+
+    const auto& amrrr = linop.AMRRefRatio();
+    m_fine_mask.clear();
+    m_fine_mask.resize(m_namrlevs);
+    for (int alev = 0; alev < m_namrlevs-1; ++alev)
+    {
+        m_fine_mask[alev] = std::make_unique<iMultiFab>
+            (makeFineMask(*a_sol[alev], *a_sol[alev+1], IntVect(0), IntVect(amrrr[alev]),
+                          Periodicity::NonPeriodic(), 1, 0));
+        if (!linop.isCellCentered()) {
+            linop.fixUpResidualMask(alev, *m_fine_mask[alev]);
+        }
+    }
+}
+
+void
+GMRESMLMG::precond (Vector<MultiFab>& z, Vector<MultiFab> const& v)
+{
+    BL_PROFILE("GMRESMLMG::precond()");
+
+    // MLMG solves with the inhomogeneous boundary data, so they are added
+    // to the right-hand side to get an approximation of the homogeneous
+    // inverse.
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        MultiFab::LinComb(m_tmp[alev], Real(1.0), v[alev], 0,
+                          Real(1.0), m_bc_term[alev], 0, 0, m_ncomp, 0);
+        z[alev].setVal(0.0);
+    }
+
+    m_mlmg.precond(GetVecOfPtrs(z), GetVecOfConstPtrs(m_tmp), m_precond_iters);
+}
+
+void
+GMRESMLMG::applyHomog (Vector<MultiFab>& out, Vector<MultiFab>& in)
+{
+    m_mlmg.apply(GetVecOfPtrs(out), GetVecOfPtrs(in));
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        MultiFab::Subtract(out[alev], m_bc_term[alev], 0, 0, m_ncomp, 0);
+    }
+}
+
+void
+GMRESMLMG::residual (Vector<MultiFab>& res, const Vector<MultiFab*>& a_sol,
+                     const Vector<MultiFab const*>& a_rhs)
+{
+    m_mlmg.compResidual(GetVecOfPtrs(res), a_sol, a_rhs);
+}
+
+Real
+GMRESMLMG::dotLocal (Vector<MultiFab> const& x, Vector<MultiFab> const& y) const
+{
+    Real r = 0.0;
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        if (m_fine_mask[alev]) {
+            r += MultiFab::Dot(*m_fine_mask[alev], x[alev], 0, y[alev], 0, m_ncomp, 0, true);
+        } else {
+            r += MultiFab::Dot(x[alev], 0, y[alev], 0, m_ncomp, 0, true);
+        }
+    }
+    return r;
+}
+
+Real
+GMRESMLMG::dotLocal (Vector<MultiFab const*> const& x) const
+{
+    Real r = 0.0;
+    for (int alev = 0; alev < m_namrlevs; ++alev) {
+        if (m_fine_mask[alev]) {
+            r += MultiFab::Dot(*m_fine_mask[alev], *x[alev], 0, *x[alev], 0, m_ncomp, 0, true);
+        } else {
+            r += MultiFab::Dot(*x[alev], 0, *x[alev], 0, m_ncomp, 0, true);
+        }
+    }
+    return r;
+}
+
+// Orthogonalize m_w against m_v[0:j] with classical Gram-Schmidt, store the
+// coefficients in column j of the Hessenberg matrix and normalize m_w into
+// m_v[j+1].  The projections and the norm of each pass are computed with a
+// single reduction, and the new norm follows from Pythagoras.  A second pass
+// is done only when the first one has removed more than half of the squared
+// norm, in which case the computed basis may not be orthogonal to working
+// precision.
+Real
+GMRESMLMG::orthogonalize (int j)
+{
+    BL_PROFILE("GMRESMLMG::orthogonalize()");
+
+    const int n = j+1;
+    auto& hj = m_h[j];
+    std::fill(hj.begin(), hj.end(), Real(0.0));
+
+    Vector<Real> dots(n+1);
+    Real wnorm2 = 0.0;
+    Real newnorm2 = 0.0;
+    for (int ipass = 0; ipass < 2; ++ipass)
+    {
+        for (int i = 0; i < n; ++i) {
+            dots[i] = dotLocal(m_v[i], m_w);
+        }
+        dots[n] = dotLocal(m_w, m_w);
+
+        BL_PROFILE_VAR("GMRESMLMG::ParallelAllReduce", blp_par);
+        ParallelAllReduce::Sum(dots.data(), n+1, ParallelContext::CommunicatorSub());
+        BL_PROFILE_VAR_STOP(blp_par);
+
+        wnorm2 = dots[n];
+        newnorm2 = wnorm2;
+        for (int i = 0; i < n; ++i) {
+            hj[i] += dots[i];
+            newnorm2 -= dots[i]*dots[i];
+            for (int alev = 0; alev < m_namrlevs; ++alev) {
+                MultiFab::Saxpy(m_w[alev], -dots[i], m_v[i][alev], 0, 0, m_ncomp, 0);
+            }
+        }
+
+        if (newnorm2 >= Real(0.5)*wnorm2) break;
+    }
+
+    const Real eps = std::numeric_limits<Real>::epsilon();
+    Real hnext = (newnorm2 > eps*eps*wnorm2) ? std::sqrt(newnorm2) : Real(0.0);
+    hj[n] = hnext;
+    if (hnext > Real(0.0)) {
+        for (int alev = 0; alev < m_namrlevs; ++alev) {
+            MultiFab::Copy(m_v[n][alev], m_w[alev], 0, 0, m_ncomp, 0);
+            m_v[n][alev].mult(Real(1.0)/hnext, 0, m_ncomp, 0);
+        }
+    }
+    return hnext;
+}
+
+Real
+GMRESMLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs,
+                  Real a_tol_rel, Real a_tol_abs)
+{
+    BL_PROFILE("GMRESMLMG::solve()");
+
+    const Real solve_start_time = amrex::second();
+
+    prepare(a_sol);
+    m_iter = 0;
+
+    const int m = std::max(m_restart, 1);
+    m_h.assign(m, Vector<Real>(m+1, Real(0.0)));
+    Vector<Real> cs(m), sn(m), g(m+1), y(m);
+
+    residual(m_w, a_sol, a_rhs);
+
+    Real norms[2] = {dotLocal(m_w, m_w), dotLocal(a_rhs)};
+    ParallelAllReduce::Sum(norms, 2, ParallelContext::CommunicatorSub());
+    Real resnorm = std::sqrt(norms[0]);
+    const Real bnorm = std::sqrt(norms[1]);
+
+    const Real max_norm = std::max(bnorm, resnorm);
+    const std::string norm_name = (bnorm >= resnorm) ? "bnorm" : "resid0";
+    const Real res_target = std::max(a_tol_abs, std::max(a_tol_rel,Real(1.e-16))*max_norm);
+
+    if (m_verbose >= 1) {
+        amrex::Print() << "GMRESMLMG: Initial rhs               = " << bnorm << "\n"
+                       << "GMRESMLMG: Initial residual (resid0) = " << resnorm << "\n";
+    }
+
+    bool converged = (resnorm <= res_target);
+
+    while (!converged && m_iter < m_maxiter)
+    {
+        for (int alev = 0; alev < m_namrlevs; ++alev) {
+            MultiFab::Copy(m_v[0][alev], m_w[alev], 0, 0, m_ncomp, 0);
+            m_v[0][alev].mult(Real(1.0)/resnorm, 0, m_ncomp, 0);
+        }
+        std::fill(g.begin(), g.end(), Real(0.0));
+        g[0] = resnorm;
+
+        int nk = 0;
+        for (int j = 0; j < m && m_iter < m_maxiter; ++j)
+        {
+            ++m_iter;
+            nk = j+1;
+
+            precond(m_z[j], m_v[j]);
+            applyHomog(m_w, m_z[j]);
+            const Real hnext = orthogonalize(j);
+
+            // Givens rotations for the least-squares problem
+            auto& hj = m_h[j];
+            for (int i = 0; i < j; ++i) {
+                const Real t = cs[i]*hj[i] + sn[i]*hj[i+1];
+                hj[i+1] = -sn[i]*hj[i] + cs[i]*hj[i+1];
+                hj[i] = t;
+            }
+            const Real d = std::sqrt(hj[j]*hj[j] + hj[j+1]*hj[j+1]);
+            if (d == Real(0.0)) {
+                cs[j] = Real(1.0);
+                sn[j] = Real(0.0);
+            } else {
+                cs[j] = hj[j]/d;
+                sn[j] = hj[j+1]/d;
+            }
+            hj[j] = d;
+            hj[j+1] = Real(0.0);
+            g[j+1] = -sn[j]*g[j];
+            g[j] *= cs[j];
+
+            resnorm = std::abs(g[j+1]);
+
+            if (m_verbose >= 2) {
+                amrex::Print() << "GMRESMLMG: Iteration " << std::setw(3) << m_iter
+                               << " resid/" << norm_name << " = " << resnorm/max_norm << "\n";
+            }
+
+            if (resnorm <= res_target || hnext == Real(0.0)) break;
+        }
+
+        for (int i = nk-1; i >= 0; --i) {
+            Real s = g[i];
+            for (int k = i+1; k < nk; ++k) {
+                s -= m_h[k][i]*y[k];
+            }
+            y[i] = (m_h[i][i] != Real(0.0)) ? s/m_h[i][i] : Real(0.0);
+        }
+
+        for (int i = 0; i < nk; ++i) {
+            for (int alev = 0; alev < m_namrlevs; ++alev) {
+                MultiFab::Saxpy(*a_sol[alev], y[i], m_z[i][alev], 0, 0, m_ncomp, 0);
+            }
+        }
+
+        // The true residual is used for the restart and the final check.
+        residual(m_w, a_sol, a_rhs);
+        Real rr = dotLocal(m_w, m_w);
+        ParallelAllReduce::Sum(rr, ParallelContext::CommunicatorSub());
+        resnorm = std::sqrt(rr);
+        converged = (resnorm <= res_target);
+    }
+
+    if (m_verbose >= 1) {
+        if (converged) {
+            amrex::Print() << "GMRESMLMG: Final Iter. " << m_iter
+                           << " resid, resid/" << norm_name << " = "
+                           << resnorm << ", " << resnorm/max_norm << "\n";
+        } else {
+            amrex::Print() << "GMRESMLMG: Failed to converge after " << m_iter << " iterations."
+                           << " resid, resid/" << norm_name << " = "
+                           << resnorm << ", " << resnorm/max_norm << "\n";
+        }
+        amrex::Print() << "GMRESMLMG: Solve time = " << amrex::second() - solve_start_time << "\n";
+    }
+
+    return resnorm;
+}
+
+}
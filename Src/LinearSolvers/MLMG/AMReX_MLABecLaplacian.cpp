@@ -760,6 +760,19 @@ MLABecLaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab&
                                  osm, vbx, redblack);
                 });
             } else if (regular_coarsening) {
+#if (AMREX_SPACEDIM == 3)
+                AMREX_LAUNCH_HOST_DEVICE_LAMBDA ( tbx, thread_box,
+                {
+                    abec_gsrb(thread_box, nc, solnfab, rhsfab, alpha, afab,
+                              dhx, dhy, dhz,
+                              bxfab, byfab, bzfab,
+                              m0,m2,m4,
+                              m1,m3,m5,
+                              f0fab,f2fab,f4fab,
+                              f1fab,f3fab,f5fab,
+                              vbx, redblack);
+                });
+#else
                 AMREX_HOST_DEVICE_PARALLEL_FOR_4D(tbx, nc, i, j, k, n,
                 {
                     abec_gsrb(i,j,k,n, solnfab, rhsfab, alpha, afab,
@@ -771,6 +784,7 @@ MLABecLaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab&
                               AMREX_D_DECL(f1fab,f3fab,f5fab),
                               vbx, redblack);
                 });
+#endif
             } else {
                 Gpu::LaunchSafeGuard lsg(false); // xxxxx gpu todo
                 // line solve does not with with GPU
@@ -790,6 +804,152 @@ MLABecLaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab&
     }
 }
 
+bool
+MLABecLaplacian::supportFusedCycle (int amrlev, int mglev) const
+{
+#if (AMREX_SPACEDIM == 3)
+    bool regular_coarsening = true;
+    if (amrlev == 0 && mglev > 0) {
+        regular_coarsening = mg_coarsen_ratio_vec[mglev-1] == mg_coarsen_ratio;
+    }
+    return !isTensorOp() && m_overset_mask[amrlev][mglev] == nullptr && regular_coarsening;
+#else
+    amrex::ignore_unused(amrlev,mglev);
+    return false;
+#endif
+}
+
+void
+MLABecLaplacian::FcorResRestrict (int amrlev, int fmglev, MultiFab& crse,
+                                  const MultiFab& x, const MultiFab& b) const
+{
+#if (AMREX_SPACEDIM == 3)
+    BL_PROFILE("MLABecLaplacian::FcorResRestrict()");
+
+    const MultiFab& acoef = m_a_coeffs[amrlev][fmglev];
+    const MultiFab& bxcoef = m_b_coeffs[amrlev][fmglev][0];
+    const MultiFab& bycoef = m_b_coeffs[amrlev][fmglev][1];
+    const MultiFab& bzcoef = m_b_coeffs[amrlev][fmglev][2];
+
+    const auto dxinv = m_geom[amrlev][fmglev].InvCellSizeArray();
+
+    const Real ascalar = m_a_scalar;
+    const Real bscalar = m_b_scalar;
+
+    const int ncomp = getNComp();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(crse, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto& cfab = crse.array(mfi);
+        const auto& xfab = x.const_array(mfi);
+        const auto& bfab = b.const_array(mfi);
+        const auto& afab = acoef.const_array(mfi);
+        const auto& bxfab = bxcoef.const_array(mfi);
+        const auto& byfab = bycoef.const_array(mfi);
+        const auto& bzfab = bzcoef.const_array(mfi);
+        AMREX_HOST_DEVICE_PARALLEL_FOR_4D(bx, ncomp, i, j, k, n,
+        {
+            mlabeclap_resid_restrict(i,j,k,n, cfab, xfab, bfab, afab, bxfab, byfab, bzfab,
+                                     dxinv, ascalar, bscalar);
+        });
+    }
+#else
+    amrex::ignore_unused(amrlev,fmglev,crse,x,b);
+#endif
+}
+
+void
+MLABecLaplacian::FsmoothInterp (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
+                                const MultiFab& crse, int ishell, int redblack) const
+{
+#if (AMREX_SPACEDIM == 3)
+    BL_PROFILE("MLABecLaplacian::FsmoothInterp()");
+
+    const MultiFab& acoef = m_a_coeffs[amrlev][mglev];
+    const MultiFab& bxcoef = m_b_coeffs[amrlev][mglev][0];
+    const MultiFab& bycoef = m_b_coeffs[amrlev][mglev][1];
+    const MultiFab& bzcoef = m_b_coeffs[amrlev][mglev][2];
+    const auto& undrrelxr = m_undrrelxr[amrlev][mglev];
+    const auto& maskvals  = m_maskvals [amrlev][mglev];
+
+    OrientationIter oitr;
+
+    const FabSet& f0 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f1 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f2 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f3 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f4 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f5 = undrrelxr[oitr()]; ++oitr;
+
+    const MultiMask& mm0 = maskvals[0];
+    const MultiMask& mm1 = maskvals[1];
+    const MultiMask& mm2 = maskvals[2];
+    const MultiMask& mm3 = maskvals[3];
+    const MultiMask& mm4 = maskvals[4];
+    const MultiMask& mm5 = maskvals[5];
+
+    const int nc = getNComp();
+    const Real* h = m_geom[amrlev][mglev].CellSize();
+    const Real dhx = m_b_scalar/(h[0]*h[0]);
+    const Real dhy = m_b_scalar/(h[1]*h[1]);
+    const Real dhz = m_b_scalar/(h[2]*h[2]);
+    const Real alpha = m_a_scalar;
+
+    MFItInfo mfi_info;
+    if (Gpu::notInLaunchRegion()) mfi_info.EnableTiling().SetDynamic(true);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(sol,mfi_info); mfi.isValid(); ++mfi)
+    {
+        const auto& m0 = mm0.array(mfi);
+        const auto& m1 = mm1.array(mfi);
+        const auto& m2 = mm2.array(mfi);
+        const auto& m3 = mm3.array(mfi);
+        const auto& m4 = mm4.array(mfi);
+        const auto& m5 = mm5.array(mfi);
+
+        const Box& tbx = mfi.tilebox();
+        const Box& vbx = mfi.validbox();
+        const Box& ibx = amrex::grow(vbx, -ishell);
+        const auto& solnfab = sol.array(mfi);
+        const auto& rhsfab  = rhs.const_array(mfi);
+        const auto& crsefab = crse.const_array(mfi);
+        const auto& afab    = acoef.const_array(mfi);
+
+        const auto& bxfab = bxcoef.const_array(mfi);
+        const auto& byfab = bycoef.const_array(mfi);
+        const auto& bzfab = bzcoef.const_array(mfi);
+
+        const auto& f0fab = f0.const_array(mfi);
+        const auto& f1fab = f1.const_array(mfi);
+        const auto& f2fab = f2.const_array(mfi);
+        const auto& f3fab = f3.const_array(mfi);
+        const auto& f4fab = f4.const_array(mfi);
+        const auto& f5fab = f5.const_array(mfi);
+
+        AMREX_HOST_DEVICE_PARALLEL_FOR_4D(tbx, nc, i, j, k, n,
+        {
+            abec_gsrb_interp(i,j,k,n, solnfab, rhsfab, crsefab, ibx, alpha, afab,
+                             dhx, dhy, dhz,
+                             bxfab, byfab, bzfab,
+                             m0,m2,m4,
+                             m1,m3,m5,
+                             f0fab,f2fab,f4fab,
+                             f1fab,f3fab,f5fab,
+                             vbx, redblack);
+        });
+    }
+#else
+    amrex::ignore_unused(amrlev,mglev,sol,rhs,crse,ishell,redblack);
+#endif
+}
+
 void
 MLABecLaplacian::FFlux (int amrlev, const MFIter& mfi,
                         const Array<FArrayBox*,AMREX_SPACEDIM>& flux,
@@ -939,6 +1099,21 @@ MLABecLaplacian::makeNLinOp (int /*grid_size*/) const
         nop->setCoarseFineBCLocation(cbloc);
     }
 
+    updateNLinOp(*nop);
+
+    return r;
+}
+
+void
+MLABecLaplacian::updateNLinOp (MLLinOp& a_nlinop) const
+{
+    auto nop = dynamic_cast<MLABecLaplacian*>(&a_nlinop);
+    if (!nop || m_overset_mask[0][0] == nullptr) return;
+
+    const Geometry& geom = m_geom[0].back();
+    const BoxArray& ba = m_grids[0].back();
+    const DistributionMapping& dm = m_dmap[0].back();
+
     nop->setScalars(m_a_scalar, m_b_scalar);
 
     MultiFab const& alpha_bottom = m_a_coeffs[0].back();
@@ -997,8 +1172,6 @@ MLABecLaplacian::makeNLinOp (int /*grid_size*/) const
 
     nop->setACoeffs(0, alpha);
     nop->setBCoeffs(0, GetArrOfConstPtrs(m_b_coeffs[0].back()));
-
-    return r;
 }
 
 void
@@ -441,7 +441,6 @@ MLCellABecLap::makeHypre (Hypre::Interface hypre_interface) const
     const BoxArray& ba = m_grids[0].back();
     const DistributionMapping& dm = m_dmap[0].back();
     const Geometry& geom = m_geom[0].back();
-    const auto& factory = *(m_factory[0].back());
     MPI_Comm comm = BottomCommunicator();
 
     const int mglev = NMGLevels(0)-1;
@@ -450,24 +449,38 @@ MLCellABecLap::makeHypre (Hypre::Interface hypre_interface) const
 
     auto hypre_solver = amrex::makeHypre(ba, dm, geom, comm, hypre_interface, om);
 
-    hypre_solver->setScalars(getAScalar(), getBScalar());
+    updateHypre(*hypre_solver);
+
+    return hypre_solver;
+}
+
+void
+MLCellABecLap::updateHypre (Hypre& hypre_solver) const
+{
+    const BoxArray& ba = m_grids[0].back();
+    const DistributionMapping& dm = m_dmap[0].back();
+    const auto& factory = *(m_factory[0].back());
+
+    const int mglev = NMGLevels(0)-1;
+
+    hypre_solver.setScalars(getAScalar(), getBScalar());
 
     auto ac = getACoeffs(0, mglev);
     if (ac)
     {
-        hypre_solver->setACoeffs(*ac);
+        hypre_solver.setACoeffs(*ac);
     }
     else
     {
         MultiFab alpha(ba,dm,1,0,MFInfo(),factory);
         alpha.setVal(0.0);
-        hypre_solver->setACoeffs(alpha);
+        hypre_solver.setACoeffs(alpha);
     }
 
     auto bc = getBCoeffs(0, mglev);
     if (bc[0])
     {
-        hypre_solver->setBCoeffs(bc);
+        hypre_solver.setBCoeffs(bc);
     }
     else
     {
@@ -478,11 +491,9 @@ MLCellABecLap::makeHypre (Hypre::Interface hypre_interface) const
                               dm, 1, 0, MFInfo(), factory);
             beta[idim].setVal(1.0);
         }
-        hypre_solver->setBCoeffs(amrex::GetArrOfConstPtrs(beta));
+        hypre_solver.setBCoeffs(amrex::GetArrOfConstPtrs(beta));
     }
-    hypre_solver->setIsMatrixSingular(this->isBottomSingular());
-
-    return hypre_solver;
+    hypre_solver.setIsMatrixSingular(this->isBottomSingular());
 }
 #endif
 
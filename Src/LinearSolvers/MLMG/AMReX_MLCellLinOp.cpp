@@ -568,6 +568,90 @@ MLCellLinOp::correctionResidual (int amrlev, int mglev, MultiFab& resid, MultiFa
     MultiFab::Xpay(resid, Real(-1.0), b, 0, 0, ncomp, 0);
 }
 
+void
+MLCellLinOp::correctionResidualRestriction (int amrlev, int cmglev, MultiFab& crse,
+                                            MultiFab& resid, MultiFab& x, const MultiFab& b)
+{
+    const int fmglev = cmglev-1;
+    const IntVect ratio = (amrlev > 0) ? IntVect(2) : mg_coarsen_ratio_vec[fmglev];
+    if (Gpu::inLaunchRegion() || ratio != IntVect(2) || !supportFusedCycle(amrlev, fmglev)) {
+        MLLinOp::correctionResidualRestriction(amrlev, cmglev, crse, resid, x, b);
+        return;
+    }
+
+    BL_PROFILE("MLCellLinOp::correctionResidualRestriction()");
+
+    applyBC(amrlev, fmglev, x, BCMode::Homogeneous, StateMode::Correction);
+#ifdef AMREX_SOFT_PERF_COUNTERS
+    perf_counters.apply(x);
+    perf_counters.restrict(crse);
+#endif
+
+    // The residual is never stored on the fine level.  Only the coarse
+    // temporary is needed if crse is not on the coarsened fine layout.
+    const BoxArray& cba = amrex::coarsen(x.boxArray(), ratio);
+    if (cba == crse.boxArray() && x.DistributionMap() == crse.DistributionMap()) {
+        FcorResRestrict(amrlev, fmglev, crse, x, b);
+    } else {
+        const int ncomp = getNComp();
+        MultiFab ctmp(cba, x.DistributionMap(), ncomp, 0);
+        FcorResRestrict(amrlev, fmglev, ctmp, x, b);
+        crse.ParallelCopy(ctmp, 0, 0, ncomp);
+    }
+}
+
+void
+MLCellLinOp::interpolationSmooth (int amrlev, int fmglev, MultiFab& fine,
+                                  const MultiFab& crse, const MultiFab& rhs)
+{
+    const IntVect ratio = (amrlev > 0) ? IntVect(2) : mg_coarsen_ratio_vec[fmglev];
+    if (Gpu::inLaunchRegion() || ratio != IntVect(2) || !supportFusedCycle(amrlev, fmglev)) {
+        MLLinOp::interpolationSmooth(amrlev, fmglev, fine, crse, rhs);
+        return;
+    }
+
+    BL_PROFILE("MLCellLinOp::interpolationSmooth()");
+
+#ifdef AMREX_SOFT_PERF_COUNTERS
+    perf_counters.interpolate(fine);
+#endif
+
+    const int ncomp = getNComp();
+
+    // FillBoundary and the bc kernels only read cells near the box
+    // boundary.  Those cells get the correction now.  The interior cells
+    // get it on the fly in the two colors of the first sweep, so the full
+    // interpolation pass over the fine level is avoided.
+    const int ishell = std::max(maxorder, fine.nGrowVect().max());
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(fine,true); mfi.isValid(); ++mfi)
+    {
+        const Box& ibx = amrex::grow(mfi.validbox(), -ishell);
+        Array4<Real const> const& cfab = crse.const_array(mfi);
+        Array4<Real> const& ffab = fine.array(mfi);
+        for (Box const& bx : amrex::boxDiff(mfi.tilebox(), ibx))
+        {
+            amrex::LoopConcurrentOnCpu(bx, ncomp, [=] (int i, int j, int k, int n) noexcept
+            {
+                ffab(i,j,k,n) += cfab(amrex::coarsen(i,2), amrex::coarsen(j,2),
+                                      amrex::coarsen(k,2), n);
+            });
+        }
+    }
+
+    for (int redblack = 0; redblack < 2; ++redblack)
+    {
+        applyBC(amrlev, fmglev, fine, BCMode::Homogeneous, StateMode::Solution);
+#ifdef AMREX_SOFT_PERF_COUNTERS
+        perf_counters.smooth(fine);
+#endif
+        FsmoothInterp(amrlev, fmglev, fine, rhs, crse, ishell, redblack);
+    }
+}
+
 void
 MLCellLinOp::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, StateMode,
                       const MLMGBndry* bndry, bool skip_fillboundary) const
@@ -1282,6 +1282,16 @@ MLEBABecLap::makeHypre (Hypre::Interface hypre_interface) const
     ijmatrix_solver->setEBDirichlet(m_eb_b_coeffs[0].back().get());
     return hypre_solver;
 }
+
+void
+MLEBABecLap::updateHypre (Hypre& hypre_solver) const
+{
+    MLCellABecLap::updateHypre(hypre_solver);
+    auto ijmatrix_solver = dynamic_cast<HypreABecLap3*>(&hypre_solver);
+    if (ijmatrix_solver) {
+        ijmatrix_solver->setEBDirichlet(m_eb_b_coeffs[0].back().get());
+    }
+}
 #endif
 
 #ifdef AMREX_USE_PETSC
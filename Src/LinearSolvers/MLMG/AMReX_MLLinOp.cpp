@@ -1016,6 +1016,22 @@ MLLinOp::resizeMultiGrid (int new_size)
     }
 }
 
+void
+MLLinOp::correctionResidualRestriction (int amrlev, int cmglev, MultiFab& crse,
+                                        MultiFab& resid, MultiFab& x, const MultiFab& b)
+{
+    correctionResidual(amrlev, cmglev-1, resid, x, b, BCMode::Homogeneous);
+    restriction(amrlev, cmglev, crse, resid);
+}
+
+void
+MLLinOp::interpolationSmooth (int amrlev, int fmglev, MultiFab& fine,
+                              const MultiFab& crse, const MultiFab& rhs)
+{
+    interpolation(amrlev, fmglev, fine, crse);
+    smooth(amrlev, fmglev, fine, rhs);
+}
+
 #ifdef AMREX_USE_PETSC
 std::unique_ptr<PETScABecLap>
 MLLinOp::makePETSc () const
@@ -58,18 +58,7 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
         checkPoint(a_sol, a_rhs, a_tol_rel, a_tol_abs, checkpoint_file);
     }
 
-    if (bottom_solver == BottomSolver::Default) {
-        bottom_solver = linop.getDefaultBottomSolver();
-    }
-
-    if (bottom_solver == BottomSolver::hypre || bottom_solver == BottomSolver::petsc) {
-        int mo = linop.getMaxOrder();
-        if (a_sol[0]->hasEBFabFactory()) {
-            linop.setMaxOrder(2);
-        } else {
-            linop.setMaxOrder(std::min(3,mo));  // maxorder = 4 not supported
-        }
-    }
+    prepareBottomSolver(a_sol);
 
     bool is_nsolve = linop.m_parent;
 
@@ -84,8 +73,6 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
 
     computeMLResidual(finest_amr_lev);
 
-    int ncomp = linop.getNComp();
-
     bool local = true;
     Real resnorm0 = MLResNormInf(finest_amr_lev, local);
     Real rhsnorm0 = MLRhsNormInf(local);
@@ -119,93 +106,129 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
             amrex::Print() << "MLMG: No iterations needed\n";
         }
     } else {
+        // A setting on trial that does not converge is replaced by the
+        // last good one, and the iterations start over from the initial
+        // solution, which is kept for that.
+        bool at_trial = !is_nsolve && autoTuneBegin();
+        bool at_failed = false;
+        Vector<MultiFab> sol_at_trial;
+        if (at_trial) {
+            const int ncomp = linop.getNComp();
+            sol_at_trial.resize(namrlevs);
+            for (int alev = 0; alev < namrlevs; ++alev) {
+                sol_at_trial[alev].define(sol[alev]->boxArray(), sol[alev]->DistributionMap(),
+                                          ncomp, sol[alev]->nGrowVect(), MFInfo(),
+                                          *linop.Factory(alev));
+                MultiFab::Copy(sol_at_trial[alev], *sol[alev], 0, 0, ncomp,
+                               sol[alev]->nGrowVect());
+            }
+        }
+
         auto iter_start_time = amrex::second();
         bool converged = false;
 
         const int niters = do_fixed_number_of_iters ? do_fixed_number_of_iters : max_iters;
-        for (int iter = 0; iter < niters; ++iter)
+        for (;;)
         {
-            oneIter(iter);
+            int iter = 0;
+            bool diverged = false;
+            for (; iter < niters; ++iter)
+            {
+                oneIter(iter);
 
-            converged = false;
+                converged = false;
 
-            // Test convergence on the fine amr level
-            computeResidual(finest_amr_lev);
+                // Test convergence on the fine amr level
+                computeResidual(finest_amr_lev);
 
-            if (is_nsolve) continue;
+                if (is_nsolve) continue;
 
-            Real fine_norminf = ResNormInf(finest_amr_lev);
-            m_iter_fine_resnorm0.push_back(fine_norminf);
-            composite_norminf = fine_norminf;
-            if (verbose >= 2) {
-                amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1 << " Fine resid/"
-                               << norm_name << " = " << fine_norminf/max_norm << "\n";
-            }
-            bool fine_converged = (fine_norminf <= res_target);
-
-            if (namrlevs == 1 && fine_converged) {
-                converged = true;
-            } else if (fine_converged) {
-                // finest level is converged, but we still need to test the coarse levels
-                computeMLResidual(finest_amr_lev-1);
-                Real crse_norminf = MLResNormInf(finest_amr_lev-1);
+                Real fine_norminf = ResNormInf(finest_amr_lev);
+                m_iter_fine_resnorm0.push_back(fine_norminf);
+                composite_norminf = fine_norminf;
                 if (verbose >= 2) {
-                    amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1
-                                   << " Crse resid/" << norm_name << " = "
-                                   << crse_norminf/max_norm << "\n";
+                    amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1 << " Fine resid/"
+                                   << norm_name << " = " << fine_norminf/max_norm << "\n";
+                }
+                bool fine_converged = (fine_norminf <= res_target);
+
+                if (namrlevs == 1 && fine_converged) {
+                    converged = true;
+                } else if (fine_converged) {
+                    // finest level is converged, but we still need to test the coarse levels
+                    computeMLResidual(finest_amr_lev-1);
+                    Real crse_norminf = MLResNormInf(finest_amr_lev-1);
+                    if (verbose >= 2) {
+                        amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1
+                                       << " Crse resid/" << norm_name << " = "
+                                       << crse_norminf/max_norm << "\n";
+                    }
+                    converged = (crse_norminf <= res_target);
+                    composite_norminf = std::max(fine_norminf, crse_norminf);
+                } else {
+                    converged = false;
+                }
+
+                if (converged) {
+                    if (verbose >= 1) {
+                        amrex::Print() << "MLMG: Final Iter. " << iter+1
+                                       << " resid, resid/" << norm_name << " = "
+                                       << composite_norminf << ", "
+                                       << composite_norminf/max_norm << "\n";
+                    }
+                    break;
+                } else {
+                  if (composite_norminf > Real(1.e20)*max_norm)
+                  {
+                      diverged = true;
+                      break;
+                  }
                 }
-                converged = (crse_norminf <= res_target);
-                composite_norminf = std::max(fine_norminf, crse_norminf);
-            } else {
-                converged = false;
             }
 
-            if (converged) {
-                if (verbose >= 1) {
-                    amrex::Print() << "MLMG: Final Iter. " << iter+1
+            const bool failed = diverged || (!converged && do_fixed_number_of_iters == 0);
+            if (!failed) break;
+
+            if (at_trial) {
+                autoTuneFallBack();
+                at_trial = false;
+                at_failed = true;
+                const int ncomp = linop.getNComp();
+                for (int alev = 0; alev < namrlevs; ++alev) {
+                    MultiFab::Copy(*sol[alev], sol_at_trial[alev], 0, 0, ncomp,
+                                   sol[alev]->nGrowVect());
+                }
+                computeMLResidual(finest_amr_lev);
+                m_niters_cg.clear();
+                m_iter_fine_resnorm0.clear();
+                continue;
+            }
+
+            if (diverged) {
+                if (verbose > 0) {
+                    amrex::Print() << "MLMG: Failing to converge after " << iter+1 << " iterations."
                                    << " resid, resid/" << norm_name << " = "
                                    << composite_norminf << ", "
                                    << composite_norminf/max_norm << "\n";
                 }
-                break;
+                amrex::Abort("MLMG failing so lets stop here");
             } else {
-              if (composite_norminf > Real(1.e20)*max_norm)
-              {
-                  if (verbose > 0) {
-                      amrex::Print() << "MLMG: Failing to converge after " << iter+1 << " iterations."
-                                     << " resid, resid/" << norm_name << " = "
-                                     << composite_norminf << ", "
-                                     << composite_norminf/max_norm << "\n";
-                  }
-                  amrex::Abort("MLMG failing so lets stop here");
-              }
-            }
-        }
-
-        if (!converged && do_fixed_number_of_iters == 0) {
-            if (verbose > 0) {
-                amrex::Print() << "MLMG: Failed to converge after " << max_iters << " iterations."
-                               << " resid, resid/" << norm_name << " = "
-                               << composite_norminf << ", "
-                               << composite_norminf/max_norm << "\n";
+                if (verbose > 0) {
+                    amrex::Print() << "MLMG: Failed to converge after " << max_iters << " iterations."
+                                   << " resid, resid/" << norm_name << " = "
+                                   << composite_norminf << ", "
+                                   << composite_norminf/max_norm << "\n";
+                }
+                amrex::Abort("MLMG failed");
             }
-            amrex::Abort("MLMG failed");
         }
         timer[iter_time] = amrex::second() - iter_start_time;
-    }
 
-    IntVect ng_back = final_fill_bc ? IntVect(1) : IntVect(0);
-    if (linop.hasHiddenDimension()) {
-        ng_back[linop.hiddenDirection()] = 0;
-    }
-    for (int alev = 0; alev < namrlevs; ++alev)
-    {
-        if (a_sol[alev] != sol[alev])
-        {
-            MultiFab::Copy(*a_sol[alev], *sol[alev], 0, 0, ncomp, ng_back);
-        }
+        if (!is_nsolve && !at_failed) autoTuneEnd(resnorm0, composite_norminf);
     }
 
+    copySolutionBack(a_sol);
+
     timer[solve_time] = amrex::second() - solve_start_time;
     if (verbose >= 1) {
         ParallelReduce::Max<double>(timer.data(), timer.size(), 0,
@@ -223,6 +246,69 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
     return composite_norminf;
 }
 
+void
+MLMG::precond (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rhs,
+               int a_ncycles)
+{
+    BL_PROFILE("MLMG::precond()");
+
+    // Nothing is printed, whatever the verbosity of the solves.
+    const int verbose_solve = verbose;
+    verbose = 0;
+
+    prepareBottomSolver(a_sol);
+
+    prepareForSolve(a_sol, a_rhs);
+
+    computeMLResidual(finest_amr_lev);
+
+    for (int iter = 0; iter < a_ncycles; ++iter)
+    {
+        oneIter(iter);
+        computeResidual(finest_amr_lev);
+    }
+
+    copySolutionBack(a_sol);
+
+    verbose = verbose_solve;
+
+    ++solve_called;
+}
+
+void
+MLMG::prepareBottomSolver (const Vector<MultiFab*>& a_sol)
+{
+    if (bottom_solver == BottomSolver::Default) {
+        bottom_solver = linop.getDefaultBottomSolver();
+    }
+
+    if (bottom_solver == BottomSolver::hypre || bottom_solver == BottomSolver::petsc) {
+        int mo = linop.getMaxOrder();
+        if (a_sol[0]->hasEBFabFactory()) {
+            linop.setMaxOrder(2);
+        } else {
+            linop.setMaxOrder(std::min(3,mo));  // maxorder = 4 not supported
+        }
+    }
+}
+
+void
+MLMG::copySolutionBack (const Vector<MultiFab*>& a_sol)
+{
+    const int ncomp = linop.getNComp();
+    IntVect ng_back = final_fill_bc ? IntVect(1) : IntVect(0);
+    if (linop.hasHiddenDimension()) {
+        ng_back[linop.hiddenDirection()] = 0;
+    }
+    for (int alev = 0; alev < namrlevs; ++alev)
+    {
+        if (a_sol[alev] != sol[alev])
+        {
+            MultiFab::Copy(*a_sol[alev], *sol[alev], 0, 0, ncomp, ng_back);
+        }
+    }
+}
+
 // in  : Residual (res) on the finest AMR level
 // out : sol on all AMR levels
 void MLMG::oneIter (int iter)
@@ -420,12 +506,22 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
 
         cor[amrlev][mglev]->setVal(0.0);
         bool skip_fillboundary = true;
-        for (int i = 0; i < nu1; ++i) {
+        const int npre = numSweeps(nu1, mglev);
+        for (int i = 0; i < npre; ++i) {
             linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev],
                          skip_fillboundary);
             skip_fillboundary = false;
         }
 
+        if (fused_cycle && verbose < 4)
+        {
+            // res_crse = R(res - L(cor)) without storing rescor
+            linop.correctionResidualRestriction(amrlev, mglev+1, res[amrlev][mglev+1],
+                                                rescor[amrlev][mglev], *cor[amrlev][mglev],
+                                                res[amrlev][mglev]);
+            continue;
+        }
+
         // rescor = res - L(cor)
         computeResOfCorrection(amrlev, mglev);
 
@@ -470,7 +566,8 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
         }
         cor[amrlev][mglev_bottom]->setVal(0.0);
         bool skip_fillboundary = true;
-        for (int i = 0; i < nu1; ++i) {
+        const int npre = numSweeps(nu1, mglev_bottom);
+        for (int i = 0; i < npre; ++i) {
             linop.smooth(amrlev, mglev_bottom, *cor[amrlev][mglev_bottom], res[amrlev][mglev_bottom],
                          skip_fillboundary);
             skip_fillboundary = false;
@@ -488,8 +585,10 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
     for (int mglev = mglev_bottom-1; mglev >= mglev_top; --mglev)
     {
         BL_PROFILE_VAR("MLMG::mgVcycle_up::"+std::to_string(mglev), blp_mgv_up_lev);
-        // cor_fine += I(cor_crse)
-        addInterpCorrection(amrlev, mglev);
+        // cor_fine += I(cor_crse), fused with the first post-smoothing sweep if possible
+        const int npost = numSweeps(nu2, mglev);
+        const bool fuse_smooth = fused_cycle && npost > 0 && verbose < 4;
+        addInterpCorrection(amrlev, mglev, fuse_smooth);
         if (verbose >= 4)
         {
             computeResOfCorrection(amrlev, mglev);
@@ -497,7 +596,7 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
             amrex::Print() << "AT LEVEL "  << amrlev << " " << mglev
                            << "   UP: Norm before smooth " << norm << "\n";
         }
-        for (int i = 0; i < nu2; ++i) {
+        for (int i = fuse_smooth ? 1 : 0; i < npost; ++i) {
             linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev]);
         }
 
@@ -825,8 +924,9 @@ MLMG::interpCorrection (int alev, int mglev)
 }
 
 // (Fine MG level correction) += I(Coarse MG level correction)
+// If smooth is true, this is followed by one smoothing sweep on the fine level.
 void
-MLMG::addInterpCorrection (int alev, int mglev)
+MLMG::addInterpCorrection (int alev, int mglev, bool smooth)
 {
     BL_PROFILE("MLMG::addInterpCorrection()");
 
@@ -854,7 +954,11 @@ MLMG::addInterpCorrection (int alev, int mglev)
         cmf = &cfine;
     }
 
-    linop.interpolation(alev, mglev, fine_cor, *cmf);
+    if (smooth) {
+        linop.interpolationSmooth(alev, mglev, fine_cor, *cmf, res[alev][mglev]);
+    } else {
+        linop.interpolation(alev, mglev, fine_cor, *cmf);
+    }
 }
 
 // Compute rescor = res - L(cor)
@@ -1152,23 +1256,7 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
     IntVect ng_sol(1);
     if (linop.hasHiddenDimension()) ng_sol[linop.hiddenDirection()] = 0;
 
-    if (!linop_prepared) {
-        linop.prepareForSolve();
-        linop_prepared = true;
-    } else if (linop.needsUpdate()) {
-        linop.update();
-
-#if defined(AMREX_USE_HYPRE) && (AMREX_SPACEDIM > 1)
-        hypre_solver.reset();
-        hypre_bndry.reset();
-        hypre_node_solver.reset();
-#endif
-
-#ifdef AMREX_USE_PETSC
-        petsc_solver.reset();
-        petsc_bndry.reset();
-#endif
-    }
+    prepareLinOp();
 
     sol.resize(namrlevs);
     sol_raii.resize(namrlevs);
@@ -1343,6 +1431,35 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
     }
 }
 
+void
+MLMG::prepareLinOp ()
+{
+    if (!linop_prepared) {
+        linop.prepareForSolve();
+        linop_prepared = true;
+    } else if (linop.needsUpdate()) {
+        // Only the coefficient dependent data are rebuilt.  The MG
+        // hierarchy, masks, N-Solve grids and bottom solver boundary are kept.
+        linop.update();
+
+        if (ns_linop) {
+            linop.updateNLinOp(*ns_linop);
+        }
+
+#if defined(AMREX_USE_HYPRE) && (AMREX_SPACEDIM > 1)
+        if (hypre_solver) {
+            linop.updateHypre(*hypre_solver);
+        }
+        hypre_node_solver.reset();
+#endif
+
+#ifdef AMREX_USE_PETSC
+        petsc_solver.reset();
+        petsc_bndry.reset();
+#endif
+    }
+}
+
 void
 MLMG::prepareForNSolve ()
 {
@@ -1511,12 +1628,7 @@ MLMG::compResidual (const Vector<MultiFab*>& a_res, const Vector<MultiFab*>& a_s
         }
     }
 
-    if (!linop_prepared) {
-        linop.prepareForSolve();
-        linop_prepared = true;
-    } else if (linop.needsUpdate()) {
-        linop.update();
-    }
+    prepareLinOp();
 
     const auto& amrrr = linop.AMRRefRatio();
 
@@ -1596,12 +1708,7 @@ MLMG::apply (const Vector<MultiFab*>& out, const Vector<MultiFab*>& a_in)
         rh[alev].setVal(0.0);
     }
 
-    if (!linop_prepared) {
-        linop.prepareForSolve();
-        linop_prepared = true;
-    } else if (linop.needsUpdate()) {
-        linop.update();
-    }
+    prepareLinOp();
 
     for (int alev = 0; alev < namrlevs; ++alev) {
         linop.applyInhomogNeumannTerm(alev, rh[alev]);
@@ -2010,4 +2117,175 @@ MLMG::checkPoint (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>&
     linop.checkPoint(file_name+"/linop");
 }
 
+
+Vector<Real>
+MLMG::autoTuneCandidates (int phase) const
+{
+    Vector<Real> r;
+    auto add = [&r] (Real v) {
+        if (std::find(r.begin(), r.end(), v) == r.end()) r.push_back(v);
+    };
+
+    if (phase == at_sweeps) {
+        // Changes to the number of pre- and post-smoothing sweeps
+        const int numin = std::min(m_at_nu1, m_at_nu2);
+        const int numax = std::max(m_at_nu1, m_at_nu2);
+        for (int d : {0, -1, 1, 2}) {
+            if (numin+d >= 0 && numax+d >= 1) add(Real(d));
+        }
+    } else if (phase == at_coarse_sweeps) {
+        // Extra sweeps on the coarser half of the multigrid levels
+        add(0.0);
+        if (linop.NMGLevels(0) > 2) {
+            add(2.0);
+            add(4.0);
+        }
+    } else if (phase == at_bottom_tol) {
+        add(bottom_reltol);
+        if (bottom_solver != BottomSolver::smoother) {
+            add(1.e-2);
+            add(1.e-1);
+        }
+    } else if (phase == at_cycle) {
+        // Number of F-cycles before switching to V-cycles
+        add(Real(max_fmg_iters));
+        add(0.0);
+        add(1.0);
+        add(Real(max_iters));
+    }
+    return r;
+}
+
+void
+MLMG::autoTuneSet (int phase, Real v)
+{
+    if (phase == at_sweeps) {
+        const int d = static_cast<int>(v);
+        nu1 = m_at_nu1 + d;
+        nu2 = m_at_nu2 + d;
+    } else if (phase == at_coarse_sweeps) {
+        const int nmglevs = linop.NMGLevels(0);
+        nu_extra.assign(nmglevs, 0);
+        for (int mglev = std::max(1,nmglevs/2); mglev < nmglevs; ++mglev) {
+            nu_extra[mglev] = static_cast<int>(v);
+        }
+    } else if (phase == at_bottom_tol) {
+        bottom_reltol = v;
+    } else if (phase == at_cycle) {
+        max_fmg_iters = static_cast<int>(v);
+    }
+}
+
+// Called before the iterations of a solve.  Starts the next tuning phase
+// if needed and applies the candidate setting to be measured.  Returns
+// true if that is not the setting in use before the phase, i.e., if the
+// solve may have to fall back to it.
+bool
+MLMG::autoTuneBegin ()
+{
+    if (!m_autotune || m_at_phase == at_done) return false;
+
+    if (m_at_candidates.empty()) {
+        if (m_at_phase == at_sweeps) {
+            m_at_nu1 = nu1;
+            m_at_nu2 = nu2;
+        }
+        // Phases with a single candidate have nothing to measure.
+        while (m_at_phase != at_done) {
+            m_at_candidates = autoTuneCandidates(m_at_phase);
+            if (m_at_candidates.size() > 1) break;
+            ++m_at_phase;
+        }
+        if (m_at_phase == at_done) {
+            m_at_candidates.clear();
+            return false;
+        }
+        m_at_cand = 0;
+        m_at_cost.assign(m_at_candidates.size(), std::numeric_limits<double>::max());
+    }
+
+    autoTuneSet(m_at_phase, m_at_candidates[m_at_cand]);
+    return m_at_cand > 0;
+}
+
+// Called after the iterations of a solve with the initial and final
+// residual norms.  The cost of the candidate is the iteration time per
+// decade of residual reduction.  The time is the maximum over the
+// processes so that all of them make the same choice.
+void
+MLMG::autoTuneEnd (Real resnorm0, Real resnorm)
+{
+    if (!m_autotune || m_at_phase == at_done || m_at_candidates.empty()) return;
+
+    double t = timer[iter_time];
+    ParallelAllReduce::Max(t, ParallelContext::CommunicatorSub());
+
+    double cost = std::numeric_limits<double>::max();
+    if (resnorm <= Real(0.0)) {
+        cost = t / 16.0;
+    } else if (resnorm < resnorm0) {
+        cost = t / std::log10(static_cast<double>(resnorm0/resnorm));
+    }
+    m_at_cost[m_at_cand] = cost;
+
+    if (verbose >= 2) {
+        amrex::Print() << "MLMG: Auto-tune phase " << m_at_phase << " candidate "
+                       << m_at_candidates[m_at_cand] << ": " << cost
+                       << " seconds per decade\n";
+    }
+
+    autoTuneNext();
+}
+
+// Called when the candidate on trial does not converge.  The candidate is
+// ruled out, and the first candidate of the phase, which is the setting in
+// use before the phase, is restored for the rest of the solve, unless the
+// phase is over and its best candidate is chosen.
+void
+MLMG::autoTuneFallBack ()
+{
+    if (verbose >= 1) {
+        amrex::Print() << "MLMG: Auto-tune phase " << m_at_phase << " candidate "
+                       << m_at_candidates[m_at_cand] << " failed to converge,"
+                       << " falling back to " << m_at_candidates[0] << "\n";
+    }
+
+    m_at_cost[m_at_cand] = std::numeric_limits<double>::max();
+    autoTuneSet(m_at_phase, m_at_candidates[0]);
+
+    autoTuneNext();
+}
+
+// Moves on to the next candidate, or, after the last one, keeps the best
+// candidate of the phase and moves on to the next phase.
+void
+MLMG::autoTuneNext ()
+{
+    if (++m_at_cand < static_cast<int>(m_at_candidates.size())) return;
+
+    const int best = static_cast<int>(std::min_element(m_at_cost.begin(), m_at_cost.end())
+                                      - m_at_cost.begin());
+    autoTuneSet(m_at_phase, m_at_candidates[best]);
+
+    m_at_candidates.clear();
+    ++m_at_phase;
+
+    // Look ahead so that autoTuneDone() is accurate after the last solve.
+    while (m_at_phase != at_done && autoTuneCandidates(m_at_phase).size() <= 1) {
+        ++m_at_phase;
+    }
+
+    if (m_at_phase == at_done && verbose >= 1) {
+        amrex::Print() << "MLMG: Auto-tuned settings: nu1 = " << nu1 << ", nu2 = " << nu2
+                       << ", extra sweeps per MG level =";
+        if (nu_extra.empty()) {
+            amrex::Print() << " 0";
+        } else {
+            for (int n : nu_extra) amrex::Print() << " " << n;
+        }
+        amrex::Print() << ", bottom_reltol = " << bottom_reltol
+                       << ", max_fmg_iters = " << max_fmg_iters << "\n";
+    }
+}
+
 }
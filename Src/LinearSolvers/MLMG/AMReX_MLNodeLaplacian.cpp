@@ -191,6 +191,8 @@ MLNodeLaplacian::setSigma (int amrlev, const MultiFab& a_sigma)
     } else {
         MultiFab::Copy(*m_sigma[amrlev][0][0], a_sigma, 0, 0, 1, 0);
     }
+
+    m_needs_update = true;
 }
 
 void
@@ -257,6 +259,24 @@ MLNodeLaplacian::prepareForSolve ()
 #endif
 
     buildStencil();
+
+    m_needs_update = false;
+}
+
+void
+MLNodeLaplacian::update ()
+{
+    BL_PROFILE("MLNodeLaplacian::update()");
+
+    // New sigma on the same hierarchy.  The masks and EB integrals do not
+    // depend on sigma and are kept.
+    if (MLNodeLinOp::needsUpdate()) MLNodeLinOp::update();
+
+    averageDownCoeffs();
+
+    buildStencil();
+
+    m_needs_update = false;
 }
 
 void
@@ -461,6 +461,125 @@ MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, i
     }
 }
 
+bool
+MLPoisson::supportFusedCycle (int amrlev, int mglev) const
+{
+#if (AMREX_SPACEDIM == 3)
+    return m_overset_mask[amrlev][mglev] == nullptr && !hasHiddenDimension();
+#else
+    amrex::ignore_unused(amrlev,mglev);
+    return false;
+#endif
+}
+
+void
+MLPoisson::FcorResRestrict (int amrlev, int fmglev, MultiFab& crse,
+                            const MultiFab& x, const MultiFab& b) const
+{
+#if (AMREX_SPACEDIM == 3)
+    BL_PROFILE("MLPoisson::FcorResRestrict()");
+
+    const Real* dxinv = m_geom[amrlev][fmglev].InvCellSize();
+    const Real dhx = dxinv[0]*dxinv[0];
+    const Real dhy = dxinv[1]*dxinv[1];
+    const Real dhz = dxinv[2]*dxinv[2];
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(crse, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const auto& cfab = crse.array(mfi);
+        const auto& xfab = x.const_array(mfi);
+        const auto& bfab = b.const_array(mfi);
+        AMREX_HOST_DEVICE_PARALLEL_FOR_3D(bx, i, j, k,
+        {
+            mlpoisson_resid_restrict(i, j, k, cfab, xfab, bfab, dhx, dhy, dhz);
+        });
+    }
+#else
+    amrex::ignore_unused(amrlev,fmglev,crse,x,b);
+#endif
+}
+
+void
+MLPoisson::FsmoothInterp (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
+                          const MultiFab& crse, int ishell, int redblack) const
+{
+#if (AMREX_SPACEDIM == 3)
+    BL_PROFILE("MLPoisson::FsmoothInterp()");
+
+    const auto& undrrelxr = m_undrrelxr[amrlev][mglev];
+    const auto& maskvals  = m_maskvals [amrlev][mglev];
+
+    OrientationIter oitr;
+
+    const FabSet& f0 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f1 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f2 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f3 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f4 = undrrelxr[oitr()]; ++oitr;
+    const FabSet& f5 = undrrelxr[oitr()]; ++oitr;
+
+    const MultiMask& mm0 = maskvals[0];
+    const MultiMask& mm1 = maskvals[1];
+    const MultiMask& mm2 = maskvals[2];
+    const MultiMask& mm3 = maskvals[3];
+    const MultiMask& mm4 = maskvals[4];
+    const MultiMask& mm5 = maskvals[5];
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+    const Real dhx = dxinv[0]*dxinv[0];
+    const Real dhy = dxinv[1]*dxinv[1];
+    const Real dhz = dxinv[2]*dxinv[2];
+
+    MFItInfo mfi_info;
+    if (Gpu::notInLaunchRegion()) mfi_info.EnableTiling().SetDynamic(true);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(sol,mfi_info); mfi.isValid(); ++mfi)
+    {
+        const auto& m0 = mm0.array(mfi);
+        const auto& m1 = mm1.array(mfi);
+        const auto& m2 = mm2.array(mfi);
+        const auto& m3 = mm3.array(mfi);
+        const auto& m4 = mm4.array(mfi);
+        const auto& m5 = mm5.array(mfi);
+
+        const Box& tbx = mfi.tilebox();
+        const Box& vbx = mfi.validbox();
+        const Box& ibx = amrex::grow(vbx, -ishell);
+        const auto& solnfab = sol.array(mfi);
+        const auto& rhsfab  = rhs.const_array(mfi);
+        const auto& crsefab = crse.const_array(mfi);
+
+        const auto& f0fab = f0.const_array(mfi);
+        const auto& f1fab = f1.const_array(mfi);
+        const auto& f2fab = f2.const_array(mfi);
+        const auto& f3fab = f3.const_array(mfi);
+        const auto& f4fab = f4.const_array(mfi);
+        const auto& f5fab = f5.const_array(mfi);
+
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA ( tbx, thread_box,
+        {
+            mlpoisson_gsrb_interp(thread_box, solnfab, rhsfab, crsefab, ibx, dhx, dhy, dhz,
+                                  f0fab, m0,
+                                  f1fab, m1,
+                                  f2fab, m2,
+                                  f3fab, m3,
+                                  f4fab, m4,
+                                  f5fab, m5,
+                                  vbx, redblack);
+        });
+    }
+#else
+    amrex::ignore_unused(amrlev,mglev,sol,rhs,crse,ishell,redblack);
+#endif
+}
+
 void
 MLPoisson::FFlux (int amrlev, const MFIter& mfi,
                   const Array<FArrayBox*,AMREX_SPACEDIM>& flux,
@@ -55,9 +55,84 @@ void ParticleContainerBase::RedefineDummyMF (int lev)
         m_dummy_mf[lev] = std::make_unique<MultiFab>(ParticleBoxArray(lev),
                                                      ParticleDistributionMap(lev),
                                                      1,0,MFInfo().SetAlloc(false));
+        if (m_cost_type != CostType::None) {
+            if (lev >= m_particle_costs.size()) m_particle_costs.resize(lev+1);
+            m_particle_costs[lev] = std::make_unique<LayoutData<Real> >(ParticleBoxArray(lev),
+                                                                        ParticleDistributionMap(lev));
+            for (MFIter mfi(*m_particle_costs[lev]); mfi.isValid(); ++mfi) {
+                (*m_particle_costs[lev])[mfi] = 0.0;
+            }
+        }
     };
 }
 
+void ParticleContainerBase::setParticleCostType (CostType a_type)
+{
+    m_cost_type = a_type;
+    m_particle_costs.clear();
+    if (m_cost_type != CostType::None) {
+        for (int lev = 0; lev < m_dummy_mf.size(); ++lev) {
+            if (m_dummy_mf[lev] == nullptr) continue;
+            ParticleCosts(lev);
+        }
+    }
+}
+
+LayoutData<Real>& ParticleContainerBase::ParticleCosts (int lev)
+{
+    AMREX_ASSERT(m_cost_type != CostType::None);
+    RedefineDummyMF(lev);
+    if (lev >= m_particle_costs.size()) m_particle_costs.resize(lev+1);
+    if (m_particle_costs[lev] == nullptr) {
+        m_particle_costs[lev] = std::make_unique<LayoutData<Real> >(ParticleBoxArray(lev),
+                                                                    ParticleDistributionMap(lev));
+        for (MFIter mfi(*m_particle_costs[lev]); mfi.isValid(); ++mfi) {
+            (*m_particle_costs[lev])[mfi] = 0.0;
+        }
+    }
+    return *m_particle_costs[lev];
+}
+
+void ParticleContainerBase::resetParticleCosts ()
+{
+    for (auto& costs : m_particle_costs) {
+        if (costs == nullptr) continue;
+        for (MFIter mfi(*costs); mfi.isValid(); ++mfi) {
+            (*costs)[mfi] = 0.0;
+        }
+    }
+}
+
+void ParticleContainerBase::addParticleCosts (MultiFab& wgt, int lev,
+                                              Real mesh_weight, Real particle_weight)
+{
+    BL_PROFILE("ParticleContainer::addParticleCosts");
+
+    AMREX_ASSERT(wgt.nComp() == 1);
+
+    const auto& costs = ParticleCosts(lev);
+    MultiFab pcost(ParticleBoxArray(lev), ParticleDistributionMap(lev), 1, 0);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(pcost, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        const Real c = particle_weight * costs[mfi]
+            / static_cast<Real>(mfi.validbox().numPts());
+        auto const& a = pcost.array(mfi);
+        AMREX_HOST_DEVICE_PARALLEL_FOR_3D(bx, i, j, k,
+        {
+            a(i,j,k) = c;
+        });
+    }
+
+    if (mesh_weight != Real(1.0)) {
+        wgt.mult(mesh_weight, 0, 1);
+    }
+    wgt.ParallelAdd(pcost, 0, 0, 1);
+}
+
 void
 ParticleContainerBase::defineBufferMap () const
 {
@@ -69,6 +144,84 @@ ParticleContainerBase::defineBufferMap () const
     }
 }
 
+void
+ParticleContainerBase::checkGridCaches () const
+{
+    const int num_levs = finestLevel() + 1;
+    bool valid = (num_levs == static_cast<int>(m_cached_ba.size()));
+    for (int lev = 0; valid && lev < num_levs; ++lev)
+    {
+        valid = BoxArray::SameRefs(ParticleBoxArray(lev), m_cached_ba[lev])
+            &&  DistributionMapping::SameRefs(ParticleDistributionMap(lev), m_cached_dm[lev]);
+    }
+
+    if (!valid)
+    {
+        m_cached_ba.resize(num_levs);
+        m_cached_dm.resize(num_levs);
+        for (int lev = 0; lev < num_levs; ++lev)
+        {
+            m_cached_ba[lev] = ParticleBoxArray(lev);
+            m_cached_dm[lev] = ParticleDistributionMap(lev);
+        }
+        m_near_grids.clear();
+        m_neighbor_procs_cache.clear();
+        m_neighbor_procs_ngrow = -1;
+    }
+}
+
+const Vector<int>&
+ParticleContainerBase::NeighborProcs (int ngrow) const
+{
+    checkGridCaches();
+    if (m_neighbor_procs_ngrow != ngrow)
+    {
+        m_neighbor_procs_cache = computeNeighborProcs(this->GetParGDB(), ngrow);
+        m_neighbor_procs_ngrow = ngrow;
+    }
+    return m_neighbor_procs_cache;
+}
+
+void
+ParticleContainerBase::BuildNearGrids () const
+{
+    checkGridCaches();
+    if (!m_near_grids.empty()) return;
+
+    BL_PROFILE("ParticleContainer::BuildNearGrids");
+
+    const int num_levs = finestLevel() + 1;
+    const int MyProc = ParallelDescriptor::MyProc();
+    m_near_grids.resize(num_levs);
+    std::vector< std::pair<int, Box> > isects;
+    for (int lev = 0; lev < num_levs; ++lev)
+    {
+        const BoxArray& ba = ParticleBoxArray(lev);
+        const DistributionMapping& dm = ParticleDistributionMap(lev);
+        for (int gid = 0; gid < static_cast<int>(ba.size()); ++gid)
+        {
+            if (dm[gid] != MyProc) continue;
+
+            const Box& halo = amrex::grow(ba.getCellCenteredBox(gid), 1);
+            auto& ng = m_near_grids[lev][gid];
+            ba.intersections(halo, isects);
+            for (const auto& isec : isects)
+            {
+                if (isec.first != gid) {
+                    ng.nbors.emplace_back(isec.first, ba.getCellCenteredBox(isec.first));
+                }
+            }
+
+            ng.no_finer = true;
+            for (int flev = lev+1; flev < num_levs && ng.no_finer; ++flev)
+            {
+                const Box& fhalo = amrex::refine(halo, computeRefFac(m_gdb, lev, flev));
+                ng.no_finer = ! ParticleBoxArray(flev).intersects(fhalo);
+            }
+        }
+    }
+}
+
 void ParticleContainerBase::SetParticleBoxArray (int lev, const BoxArray& new_ba)
 {
     m_gdb_object = ParGDB(m_gdb->ParticleGeom(), m_gdb->ParticleDistributionMap(),
@@ -91,6 +244,7 @@ void ParticleContainerBase::SetParticleGeometry (int lev, const Geometry& new_ge
                           m_gdb->ParticleBoxArray(), m_gdb->refRatio());
     m_gdb = &m_gdb_object;
     m_gdb->SetParticleGeometry(lev, new_geom);
+    m_neighbor_procs_ngrow = -1;
 }
 
 const std::string& ParticleContainerBase::Version ()
@@ -46,6 +46,7 @@ AmrCoreAdv::AmrCoreAdv ()
     phi_old.resize(nlevs_max);
 
     facevel.resize(nlevs_max);
+    fillpatch_plan.resize(nlevs_max);
 
     // periodic boundaries
     int bc_lo[] = {BCType::int_dir, BCType::int_dir, BCType::int_dir};
@@ -245,6 +246,7 @@ AmrCoreAdv::ClearLevel (int lev)
     phi_new[lev].clear();
     phi_old[lev].clear();
     flux_reg[lev].reset(nullptr);
+    fillpatch_plan[lev].clear();
 }
 
 // Make a new level from scratch using provided BoxArray and DistributionMapping.
@@ -437,10 +439,10 @@ AmrCoreAdv::FillPatch (int lev, Real time, MultiFab& mf, int icomp, int ncomp)
             PhysBCFunct<GpuBndryFuncFab<AmrCoreFill> > cphysbc(geom[lev-1],bcs,gpu_bndry_func);
             PhysBCFunct<GpuBndryFuncFab<AmrCoreFill> > fphysbc(geom[lev],bcs,gpu_bndry_func);
 
-            amrex::FillPatchTwoLevels(mf, time, cmf, ctime, fmf, ftime,
-                                      0, icomp, ncomp, geom[lev-1], geom[lev],
-                                      cphysbc, 0, fphysbc, 0, refRatio(lev-1),
-                                      mapper, bcs, 0);
+            fillpatch_plan[lev].FillPatchTwoLevels(mf, time, cmf, ctime, fmf, ftime,
+                                                   0, icomp, ncomp, geom[lev-1], geom[lev],
+                                                   cphysbc, 0, fphysbc, 0, refRatio(lev-1),
+                                                   mapper, bcs, 0);
         }
         else
         {
@@ -448,10 +450,10 @@ AmrCoreAdv::FillPatch (int lev, Real time, MultiFab& mf, int icomp, int ncomp)
             PhysBCFunct<CpuBndryFuncFab> cphysbc(geom[lev-1],bcs,bndry_func);
             PhysBCFunct<CpuBndryFuncFab> fphysbc(geom[lev],bcs,bndry_func);
 
-            amrex::FillPatchTwoLevels(mf, time, cmf, ctime, fmf, ftime,
-                                      0, icomp, ncomp, geom[lev-1], geom[lev],
-                                      cphysbc, 0, fphysbc, 0, refRatio(lev-1),
-                                      mapper, bcs, 0);
+            fillpatch_plan[lev].FillPatchTwoLevels(mf, time, cmf, ctime, fmf, ftime,
+                                                   0, icomp, ncomp, geom[lev-1], geom[lev],
+                                                   cphysbc, 0, fphysbc, 0, refRatio(lev-1),
+                                                   mapper, bcs, 0);
         }
     }
 }
@@ -117,6 +117,44 @@ AmrLevelAdv::writePlotFile (const std::string& dir,
 /**
  * Define data descriptors.
  */
+namespace {
+
+Box the_same_box (const Box& b) { return b; }
+Box grow_box_by_one (const Box& b) { return amrex::grow(b,1); }
+
+void derive_phisq (const Box& bx, FArrayBox& derfab, int dcomp, int /*ncomp*/,
+                   const FArrayBox& datafab, const Geometry& /*geomdata*/,
+                   Real /*time*/, const int* /*bcrec*/, int /*level*/)
+{
+    auto const phi = datafab.const_array();
+    auto       der = derfab.array();
+    amrex::ParallelFor(bx,
+    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        der(i,j,k,dcomp) = phi(i,j,k)*phi(i,j,k);
+    });
+}
+
+// |grad phi| with centered differences
+void derive_phigrad (const Box& bx, FArrayBox& derfab, int dcomp, int /*ncomp*/,
+                     const FArrayBox& datafab, const Geometry& geomdata,
+                     Real /*time*/, const int* /*bcrec*/, int /*level*/)
+{
+    auto const phi = datafab.const_array();
+    auto       der = derfab.array();
+    const auto dxinv = geomdata.InvCellSizeArray();
+    amrex::ParallelFor(bx,
+    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        AMREX_D_TERM(Real gx = 0.5*dxinv[0]*(phi(i+1,j,k)-phi(i-1,j,k));,
+                     Real gy = 0.5*dxinv[1]*(phi(i,j+1,k)-phi(i,j-1,k));,
+                     Real gz = 0.5*dxinv[2]*(phi(i,j,k+1)-phi(i,j,k-1)););
+        der(i,j,k,dcomp) = std::sqrt(AMREX_D_TERM(gx*gx, + gy*gy, + gz*gz));
+    });
+}
+
+}
+
 void
 AmrLevelAdv::variableSetUp ()
 {
@@ -146,6 +184,18 @@ AmrLevelAdv::variableSetUp ()
 
     desc_lst.setComponent(Phi_Type, 0, "phi", bc,
                           bndryfunc);
+
+    //
+    // Derived quantities.  Both use phi, which is filled once when they
+    // are plotted together.
+    //
+    derive_lst.add("phisq",IndexType::TheCellType(),1,
+                   derive_phisq,the_same_box);
+    derive_lst.addComponent("phisq",desc_lst,Phi_Type,0,1);
+
+    derive_lst.add("phigrad",IndexType::TheCellType(),1,
+                   derive_phigrad,grow_box_by_one);
+    derive_lst.addComponent("phigrad",desc_lst,Phi_Type,0,1);
 }
 
 /**
@@ -196,7 +246,8 @@ AmrLevelAdv::init (AmrLevel &old)
     AmrLevelAdv* oldlev = (AmrLevelAdv*) &old;
 
     //
-    // Create new grid data by fillpatching from old.
+    // Create new grid data from old.  The data of the unchanged grids
+    // are moved, and the rest are fillpatched.
     //
     Real dt_new    = parent->dtLevel(level);
     Real cur_time  = oldlev->state[Phi_Type].curTime();
@@ -204,9 +255,7 @@ AmrLevelAdv::init (AmrLevel &old)
     Real dt_old    = cur_time - prev_time;
     setTimeLevel(cur_time,dt_old,dt_new);
 
-    MultiFab& S_new = get_new_data(Phi_Type);
-
-    FillPatch(old, S_new, 0, cur_time, Phi_Type, 0, NUM_STATE);
+    FillFromOldLevel(old, cur_time, Phi_Type);
 }
 
 /**
@@ -387,8 +436,11 @@ AmrLevelAdv::advance (Real time,
                 current->FineAdd(fluxes[i],i,0,0,NUM_STATE,1.);
         }
         if (fine) {
+            // The coarse fluxes are only needed by reflux, so the
+            // communication can overlap with the advance of level+1.
             for (int i = 0; i < BL_SPACEDIM ; i++)
-                fine->CrseInit(fluxes[i],i,0,0,NUM_STATE,-1.);
+                fine->CrseInit_nowait(fluxes[i],i,0,0,NUM_STATE,-1.);
+            deferUntilPostTimestep([fine] () { fine->CrseInit_finish(); });
         }
     }
 
@@ -0,0 +1,272 @@
+#include <AMReX.H>
+#include <AMReX_Amr.H>
+#include <AMReX_AmrLevel.H>
+#include <AMReX_LevelBld.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Interpolater.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+//
+// Checks the FillPatchIterator cache of AmrLevel (amr.fillpatch_cache) on
+// a two-level hierarchy: a fill at the old time is kept and reused, a fill
+// at the new time is not kept, and the kept fill is not used after
+// StateData::setModified, after swapTimeLevels, or after the coarse level
+// is modified.
+//
+
+extern "C" {
+    void amrex_probinit (const int* /*init*/,
+                         const int* /*name*/,
+                         const int* /*namelen*/,
+                         const amrex::Real* /*problo*/,
+                         const amrex::Real* /*probhi*/)
+    {}
+}
+
+namespace {
+
+void nullfill (Box const& /*bx*/, FArrayBox& /*data*/,
+               const int /*dcomp*/, const int /*numcomp*/,
+               Geometry const& /*geom*/, const Real /*time*/,
+               const Vector<BCRec>& /*bcr*/, const int /*bcomp*/,
+               const int /*scomp*/)
+{}
+
+class CacheLevel
+    : public AmrLevel
+{
+public:
+
+    CacheLevel () = default;
+
+    CacheLevel (Amr& papa, int lev, const Geometry& level_geom, const BoxArray& ba,
+                const DistributionMapping& dm, Real time)
+        : AmrLevel(papa, lev, level_geom, ba, dm, time)
+    {}
+
+    static void variableSetUp ()
+    {
+        desc_lst.addDescriptor(0, IndexType::TheCellType(), StateDescriptor::Point,
+                               0, 1, &cell_cons_interp);
+        BCRec bc(AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir),
+                 AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir));
+        desc_lst.setComponent(0, 0, "phi", bc, StateDescriptor::BndryFunc(nullfill));
+    }
+
+    static void variableCleanUp ()
+    {
+        desc_lst.clear();
+        derive_lst.clear();
+    }
+
+    virtual void computeInitialDt (int finest_level, int /*sub_cycle*/, Vector<int>& /*n_cycle*/,
+                                   const Vector<IntVect>& /*ref_ratio*/, Vector<Real>& dt_level,
+                                   Real /*stop_time*/) override
+    {
+        for (int lev = 0; lev <= finest_level; ++lev) dt_level[lev] = 1.0;
+    }
+
+    virtual void computeNewDt (int finest_level, int sub_cycle, Vector<int>& n_cycle,
+                               const Vector<IntVect>& ref_ratio, Vector<Real>& /*dt_min*/,
+                               Vector<Real>& dt_level, Real stop_time,
+                               int /*post_regrid_flag*/) override
+    {
+        computeInitialDt(finest_level, sub_cycle, n_cycle, ref_ratio, dt_level, stop_time);
+    }
+
+    virtual Real advance (Real /*time*/, Real dt, int /*iteration*/, int /*ncycle*/) override
+    {
+        return dt;
+    }
+
+    virtual void post_timestep (int /*iteration*/) override {}
+    virtual void post_regrid (int /*lbase*/, int /*new_finest*/) override {}
+    virtual void post_init (Real /*stop_time*/) override {}
+
+    virtual void initData () override
+    {
+        MultiFab& S_new = get_new_data(0);
+        const auto problo = geom.ProbLoArray();
+        const auto dx = geom.CellSizeArray();
+        for (MFIter mfi(S_new); mfi.isValid(); ++mfi)
+        {
+            auto const& a = S_new.array(mfi);
+            amrex::ParallelFor(mfi.validbox(),
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                amrex::ignore_unused(j,k);
+                Real r = std::sin(Real(6.283185307179586)*(problo[0]+(i+Real(0.5))*dx[0]));
+#if (AMREX_SPACEDIM > 1)
+                r += std::cos(Real(6.283185307179586)*(problo[1]+(j+Real(0.5))*dx[1]));
+#endif
+                a(i,j,k) = r;
+            });
+        }
+    }
+
+    virtual void init (AmrLevel& old) override
+    {
+        MultiFab& S_new = get_new_data(0);
+        const Real cur_time = old.get_state_data(0).curTime();
+        FillPatch(old, S_new, 0, cur_time, 0, 0, 1);
+    }
+
+    virtual void init () override
+    {
+        MultiFab& S_new = get_new_data(0);
+        const Real cur_time = getLevel(level-1).get_state_data(0).curTime();
+        FillCoarsePatch(S_new, 0, cur_time, 0, 0, 1);
+    }
+
+    virtual void errorEst (TagBoxArray& tags, int /*clearval*/, int tagval, Real /*time*/,
+                           int /*n_error_buf*/, int /*ngrow*/) override
+    {
+        // Refine the middle of the domain.
+        const Box center = amrex::grow(geom.Domain(), -geom.Domain().length(0)/4 - 1);
+        for (MFIter mfi(tags); mfi.isValid(); ++mfi)
+        {
+            const Box bx = mfi.validbox() & center;
+            if (bx.ok()) tags[mfi].setVal<RunOn::Host>(static_cast<TagBox::TagType>(tagval), bx);
+        }
+    }
+
+    CacheLevel& getLevel (int lev) { return static_cast<CacheLevel&>(parent->getLevel(lev)); }
+};
+
+class CacheLevelBld
+    : public LevelBld
+{
+    virtual void variableSetUp () override { CacheLevel::variableSetUp(); }
+    virtual void variableCleanUp () override { CacheLevel::variableCleanUp(); }
+    virtual AmrLevel* operator() () override { return new CacheLevel; }
+    virtual AmrLevel* operator() (Amr& papa, int lev, const Geometry& level_geom,
+                                  const BoxArray& ba, const DistributionMapping& dm,
+                                  Real time) override
+    {
+        return new CacheLevel(papa, lev, level_geom, ba, dm, time);
+    }
+};
+
+CacheLevelBld cache_bld;
+
+constexpr int ng = 2;
+
+MultiFab fill (AmrLevel& amrlevel, Real time)
+{
+    MultiFab mf(amrlevel.boxArray(), amrlevel.DistributionMap(), 1, ng);
+    AmrLevel::FillPatch(amrlevel, mf, ng, time, 0, 0, 1);
+    return mf;
+}
+
+// min and max of a - b on the valid cells grown by nghost
+std::pair<Real,Real> diff (const MultiFab& a, const MultiFab& b, int nghost)
+{
+    MultiFab d(a.boxArray(), a.DistributionMap(), 1, ng);
+    MultiFab::Copy(d, a, 0, 0, 1, ng);
+    MultiFab::Subtract(d, b, 0, 0, 1, ng);
+    return std::make_pair(d.min(0, nghost), d.max(0, nghost));
+}
+
+bool near (Real a, Real b) { return std::abs(a-b) < Real(1.e-10); }
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        Amr amr(&cache_bld);
+        amr.init(0.0, -1.0);
+
+        AMREX_ALWAYS_ASSERT(amr.finestLevel() == 1);
+
+        // Make the initial data the old time level of every level.
+        for (int lev = 0; lev <= amr.finestLevel(); ++lev) {
+            StateData& sd = amr.getLevel(lev).get_state_data(0);
+            sd.allocOldData();
+            sd.swapTimeLevels(1.0);
+            MultiFab::Copy(sd.newData(), sd.oldData(), 0, 0, 1, 0);
+            sd.newData().plus(10.0, 0, 1, 0);
+        }
+
+        for (int lev = 0; lev <= amr.finestLevel(); ++lev)
+        {
+            amrex::Print() << "Level " << lev << "\n";
+            AmrLevel& amrlevel = amr.getLevel(lev);
+            StateData& sd = amrlevel.get_state_data(0);
+            const Real t_old = sd.prevTime();
+
+            // A reference taken before the fill: writes through it are not seen.
+            MultiFab& S_old = sd.oldData();
+
+            MultiFab a = fill(amrlevel, t_old);
+            S_old.plus(1.0, 0, 1, 0);
+            MultiFab b = fill(amrlevel, t_old);
+            auto d = diff(b, a, ng);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d.first == 0.0 && d.second == 0.0,
+                                             "hit returns the kept fill");
+
+            sd.setModified();
+            MultiFab c = fill(amrlevel, t_old);
+            d = diff(c, a, 0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(near(d.first, 1.0) && near(d.second, 1.0),
+                                             "miss after setModified");
+
+            // Fills of the new time level are not kept.
+            const Real t_new = sd.curTime();
+            MultiFab& S_new = sd.newData();
+            MultiFab e = fill(amrlevel, t_new);
+            S_new.plus(1.0, 0, 1, 0);
+            MultiFab f = fill(amrlevel, t_new);
+            d = diff(f, e, 0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(near(d.first, 1.0) && near(d.second, 1.0),
+                                             "new time not kept");
+        }
+
+        {
+            amrex::Print() << "Coarse level modified\n";
+            AmrLevel& fine = amr.getLevel(1);
+            StateData& csd = amr.getLevel(0).get_state_data(0);
+            const Real t_old = fine.get_state_data(0).prevTime();
+
+            MultiFab& S_crse = csd.oldData();
+
+            MultiFab a = fill(fine, t_old);
+            S_crse.plus(1.0, 0, 1, 0);
+            MultiFab b = fill(fine, t_old);
+            auto d = diff(b, a, ng);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d.first == 0.0 && d.second == 0.0,
+                                             "hit returns the kept fill");
+
+            csd.setModified();
+            MultiFab c = fill(fine, t_old);
+            d = diff(c, a, 0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d.first == 0.0 && d.second == 0.0,
+                                             "valid cells unchanged");
+            d = diff(c, a, ng);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(near(d.second, 1.0), "miss after coarse setModified");
+        }
+
+        for (int lev = 0; lev <= amr.finestLevel(); ++lev)
+        {
+            amrex::Print() << "Level " << lev << " after swapTimeLevels\n";
+            AmrLevel& amrlevel = amr.getLevel(lev);
+            StateData& sd = amrlevel.get_state_data(0);
+
+            MultiFab a = fill(amrlevel, sd.prevTime());
+            sd.swapTimeLevels(1.0);
+            MultiFab b = fill(amrlevel, sd.prevTime());
+            // The old data is now the new data of before, which was the
+            // initial data plus 11, and the old data of before was the
+            // initial data plus 1 (plus 1 on level 0 for the coarse test).
+            const Real expected = (lev == 0) ? Real(9.0) : Real(10.0);
+            auto d = diff(b, a, 0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(near(d.first, expected) && near(d.second, expected),
+                                             "miss after swapTimeLevels");
+        }
+    }
+    amrex::Finalize();
+}
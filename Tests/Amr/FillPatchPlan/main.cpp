@@ -0,0 +1,189 @@
+// Checks FillPatchPlan::FillPatchTwoLevels against amrex::FillPatchTwoLevels
+// on fine grids that touch a periodic boundary, a physical boundary and each
+// other, at the coarse and fine times and between them.  The results must be
+// the same, including the ghost cells, and the plan must be built once for
+// as long as the destination keeps its grids, ghost cells, components and
+// interpolater, and built anew when one of them changes.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_FillPatchUtil.H>
+#include <AMReX_PhysBCFunct.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+namespace {
+
+// A smooth function of the cell centers and the time that differs between
+// the levels, so that interpolated coarse data are told apart from fine data.
+void fill (MultiFab& mf, Geometry const& geom, int lev, Real time)
+{
+    const auto plo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto const& a = mf.array(mfi);
+        amrex::ParallelFor(mfi.validbox(), mf.nComp(),
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            AMREX_D_TERM(const Real x = plo[0] + (i+Real(0.5))*dx[0];,
+                         const Real y = plo[1] + (j+Real(0.5))*dx[1];,
+                         const Real z = plo[2] + (k+Real(0.5))*dx[2];)
+            a(i,j,k,n) = (lev+1) * std::sin(Real(6.0)*x + n + Real(3.0)*time)
+                AMREX_D_TERM(, + std::cos(Real(5.0)*y - time), * (Real(1.0) + z*z + n*time));
+        });
+    }
+}
+
+// Max |a-b| over the valid and ghost cells
+Real maxDiff (MultiFab const& a, MultiFab const& b)
+{
+    MultiFab d(a.boxArray(), a.DistributionMap(), a.nComp(), a.nGrowVect());
+    MultiFab::Copy(d, a, 0, 0, a.nComp(), a.nGrowVect());
+    MultiFab::Subtract(d, b, 0, 0, a.nComp(), a.nGrowVect());
+    return d.norm0(0, a.nComp(), a.nGrowVect());
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        int ncomp = 3;
+        int nghost = 2;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("ncomp", ncomp);
+            pp.query("nghost", nghost);
+        }
+
+        // Periodic in all but the last direction
+        const IntVect ratio(2);
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        Array<int,AMREX_SPACEDIM> is_per;
+        is_per.fill(1);
+        is_per[AMREX_SPACEDIM-1] = 0;
+        const Box cdomain(IntVect(0), IntVect(n_cell-1));
+        const Geometry cgeom(cdomain, rb, CoordSys::cartesian, is_per);
+        const Geometry fgeom(amrex::refine(cdomain, ratio), rb, CoordSys::cartesian, is_per);
+
+        BoxArray cba(cdomain);
+        cba.maxSize(max_grid_size);
+        const DistributionMapping cdm(cba);
+
+        // Fine grids at the low end of the domain in every direction, so
+        // that their ghost cells cross the periodic and physical boundaries.
+        const Box fregion = amrex::refine(Box(IntVect(0), IntVect(n_cell/2-1)), ratio);
+        BoxArray fba(fregion);
+        fba.maxSize(max_grid_size);
+        const DistributionMapping fdm(fba);
+
+        const Vector<Real> ct{0.0, 1.0};
+        const Vector<Real> ft{0.0, 1.0};
+        Vector<MultiFab> crse(2), fine(2);
+        for (int t = 0; t < 2; ++t) {
+            crse[t].define(cba, cdm, ncomp, 0);
+            fill(crse[t], cgeom, 0, ct[t]);
+            fine[t].define(fba, fdm, ncomp, 0);
+            fill(fine[t], fgeom, 1, ft[t]);
+        }
+        const Vector<MultiFab*> cmf{&crse[0], &crse[1]};
+        const Vector<MultiFab*> fmf{&fine[0], &fine[1]};
+
+        Vector<BCRec> bcs(ncomp);
+        for (auto& bc : bcs) {
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                const int t = is_per[idim] ? BCType::int_dir : BCType::foextrap;
+                bc.setLo(idim, t);
+                bc.setHi(idim, t);
+            }
+        }
+        CpuBndryFuncFab bndry_func(nullptr);
+        PhysBCFunct<CpuBndryFuncFab> cphysbc(cgeom, bcs, bndry_func);
+        PhysBCFunct<CpuBndryFuncFab> fphysbc(fgeom, bcs, bndry_func);
+
+        // Fills the components 1.. of the sources into 0.. of the destination.
+        const int scomp = 1;
+        const int dcomp = 0;
+        const int nc = ncomp-1;
+
+        FillPatchPlan<MultiFab> plan;
+
+        // Fills with the plan and without it at the coarse and fine times
+        // and between them, and returns the largest difference.
+        auto compare = [&] (BoxArray const& ba, DistributionMapping const& dm, int ng,
+                            auto* mapper, Vector<MultiFab*> const& fsrc) -> Real
+        {
+            Real r = 0.0;
+            for (Real time : {Real(0.0), Real(0.25), Real(0.5), Real(1.0)}) {
+                MultiFab a(ba, dm, nc, ng);
+                MultiFab b(ba, dm, nc, ng);
+                a.setVal(-1.0);
+                b.setVal(-2.0);
+                plan.FillPatchTwoLevels(a, time, cmf, ct, fsrc, ft, scomp, dcomp, nc,
+                                        cgeom, fgeom, cphysbc, 0, fphysbc, 0, ratio,
+                                        mapper, bcs, scomp);
+                amrex::FillPatchTwoLevels(b, time, cmf, ct, fsrc, ft, scomp, dcomp, nc,
+                                          cgeom, fgeom, cphysbc, 0, fphysbc, 0, ratio,
+                                          mapper, bcs, scomp);
+                r = std::max(r, maxDiff(a, b));
+            }
+            return r;
+        };
+
+        amrex::Print() << "The same destination grids\n";
+        {
+            const Real d = compare(fba, fdm, nghost, &cell_cons_interp, fmf);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d == 0.0, "same as FillPatchTwoLevels");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(plan.numDefines() == 1,
+                                             "built once for all the times");
+            // A copy of the BoxArray is the same grids.
+            const Real d2 = compare(BoxArray(fba), fdm, nghost, &cell_cons_interp, fmf);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d2 == 0.0 && plan.numDefines() == 1,
+                                             "reused for a copy of the grids");
+        }
+
+        amrex::Print() << "Fewer ghost cells\n";
+        {
+            const Real d = compare(fba, fdm, nghost-1, &cell_cons_interp, fmf);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d == 0.0, "same as FillPatchTwoLevels");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(plan.numDefines() == 2, "built again");
+        }
+
+        amrex::Print() << "Another interpolater\n";
+        {
+            const Real d = compare(fba, fdm, nghost-1, &pc_interp, fmf);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d == 0.0, "same as FillPatchTwoLevels");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(plan.numDefines() == 3, "built again");
+        }
+
+        amrex::Print() << "New destination grids\n";
+        {
+            BoxArray fba2(fregion);
+            fba2.maxSize(IntVect(AMREX_D_DECL(max_grid_size, max_grid_size, max_grid_size/2)));
+            const DistributionMapping fdm2(fba2);
+            Vector<MultiFab> fine2(2);
+            for (int t = 0; t < 2; ++t) {
+                fine2[t].define(fba2, fdm2, ncomp, 0);
+                fill(fine2[t], fgeom, 1, ft[t]);
+            }
+            const Real d = compare(fba2, fdm2, nghost, &cell_cons_interp,
+                                   {&fine2[0], &fine2[1]});
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d == 0.0, "same as FillPatchTwoLevels");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(plan.numDefines() == 4, "built again");
+            const Real d2 = compare(fba2, fdm2, nghost, &cell_cons_interp,
+                                    {&fine2[0], &fine2[1]});
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d2 == 0.0 && plan.numDefines() == 4,
+                                             "reused on the next calls");
+        }
+    }
+    amrex::Finalize();
+}
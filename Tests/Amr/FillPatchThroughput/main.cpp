@@ -0,0 +1,130 @@
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_MultiFabUtil.H>
+#include <AMReX_PhysBCFunct.H>
+#include <AMReX_FillPatchUtil.H>
+#include <AMReX_Interpolater.H>
+#include <AMReX_MFInterpolater.H>
+
+#include <cmath>
+#include <string>
+
+using namespace amrex;
+
+//
+// Times InterpFromCoarseLevel, the interpolation part of FillPatch, for the
+// conservative interpolaters and reports the throughput in fine cells per
+// second.  The interpolated data are averaged down and compared with the
+// coarse data, which they must conserve.
+//
+void test_interp (const std::string& name, InterpBase* mapper, int ratio,
+                  int n_cell, int max_grid_size, int ncomp, int nrepeat);
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        int ncomp = 2;
+        int nrepeat = 2;
+        Vector<int> ratios{2, 4};
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("ncomp", ncomp);
+            pp.query("nrepeat", nrepeat);
+            pp.queryarr("ratios", ratios);
+        }
+
+        for (int ratio : ratios) {
+            test_interp("cell_cons_interp", &cell_cons_interp, ratio,
+                        n_cell, max_grid_size, ncomp, nrepeat);
+            test_interp("mf_cell_cons_interp", &mf_cell_cons_interp, ratio,
+                        n_cell, max_grid_size, ncomp, nrepeat);
+            if (ratio == 2) {
+                test_interp("quartic_interp", &quartic_interp, ratio,
+                            n_cell, max_grid_size, ncomp, nrepeat);
+            }
+        }
+    }
+    amrex::Finalize();
+}
+
+void test_interp (const std::string& name, InterpBase* mapper, int ratio,
+                  int n_cell, int max_grid_size, int ncomp, int nrepeat)
+{
+    const IntVect rr(ratio);
+
+    RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+    Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(1,1,1)};
+    const Box cdomain(IntVect(0), IntVect(n_cell-1));
+    const Geometry cgeom(cdomain, rb, CoordSys::cartesian, is_periodic);
+    const Geometry fgeom(amrex::refine(cdomain,rr), rb, CoordSys::cartesian, is_periodic);
+
+    BoxArray cba(cdomain);
+    cba.maxSize(max_grid_size);
+    MultiFab cmf(cba, DistributionMapping(cba), ncomp, 0);
+
+    const auto dx = cgeom.CellSizeArray();
+    for (MFIter mfi(cmf); mfi.isValid(); ++mfi) {
+        auto const& a = cmf.array(mfi);
+        amrex::ParallelFor(mfi.validbox(), ncomp,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            amrex::ignore_unused(j,k);
+            const Real x = (i+Real(0.5))*dx[0];
+            Real r = std::sin(Real(2.0)*Real(3.141592653589793)*x) + Real(n);
+#if (AMREX_SPACEDIM > 1)
+            const Real y = (j+Real(0.5))*dx[1];
+            r += Real(0.5)*std::cos(Real(4.0)*Real(3.141592653589793)*y);
+#endif
+#if (AMREX_SPACEDIM > 2)
+            const Real z = (k+Real(0.5))*dx[2];
+            r += x*y*z;
+#endif
+            a(i,j,k,n) = r;
+        });
+    }
+
+    // The fine level covers the middle half of the domain.
+    BoxArray fba(amrex::refine(amrex::grow(cdomain, -n_cell/4), rr));
+    fba.maxSize(max_grid_size);
+    MultiFab fmf(fba, DistributionMapping(fba), ncomp, 0);
+
+    PhysBCFunctNoOp bcnoop;
+    Vector<BCRec> bcs(ncomp, BCRec(AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir),
+                                   AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir)));
+
+    auto fill = [&] () {
+        InterpFromCoarseLevel(fmf, Real(0.0), cmf, 0, 0, ncomp, cgeom, fgeom,
+                              bcnoop, 0, bcnoop, 0, rr, mapper, bcs, 0);
+    };
+
+    fill(); // warm up
+
+    ParallelDescriptor::Barrier();
+    const double t0 = amrex::second();
+    for (int i = 0; i < nrepeat; ++i) {
+        fill();
+    }
+    ParallelDescriptor::Barrier();
+    double t = (amrex::second() - t0) / nrepeat;
+    ParallelDescriptor::ReduceRealMax(t);
+
+    // Conservation: the fine data averaged down must be the coarse data.
+    MultiFab cfine(amrex::coarsen(fba,rr), fmf.DistributionMap(), ncomp, 0);
+    amrex::average_down(fmf, cfine, 0, ncomp, rr);
+    MultiFab cref(cfine.boxArray(), cfine.DistributionMap(), ncomp, 0);
+    cref.ParallelCopy(cmf, 0, 0, ncomp);
+    MultiFab::Subtract(cref, cfine, 0, 0, ncomp, 0);
+    const Real err = cref.norminf(0, ncomp, IntVect(0));
+
+    amrex::Print() << "  " << name << ", ratio " << ratio << ": "
+                   << static_cast<double>(fba.numPts()*ncomp)/t << " fine cells/s"
+                   << ", conservation error " << err << "\n";
+
+    AMREX_ALWAYS_ASSERT(err < Real(1.e-10));
+}
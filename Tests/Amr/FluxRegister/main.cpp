@@ -0,0 +1,307 @@
+// Checks the packed FluxRegister::CrseInit, CrseAdd and Reflux, which move
+// the register boxes of all the faces with one communication, against the
+// per-face paths they replaced.  The registers have several components,
+// and the fluxes and the state are read and written from components other
+// than the first.  The fine grids touch each other and the periodic
+// boundaries, and the coarse grids are smaller than the fine ones, so the
+// copies go across grids and processes.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_FluxRegister.H>
+#include <AMReX_FluxReg_C.H>
+
+#include <cmath>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+
+void fill (MultiFab& mf, int seed, Real offset = 0.0)
+{
+    const Real s = Real(seed);
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto const& a = mf.array(mfi);
+        amrex::ParallelFor(mfi.fabbox(), mf.nComp(),
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            a(i,j,k,n) = offset + std::sin(Real(0.37)*i + s) * std::cos(Real(0.23)*j - n)
+                                + std::sin(Real(0.11)*k*(n+1) + s*Real(0.5));
+        });
+    }
+}
+
+// The largest difference between the registers of all the faces, relative
+// to the largest value of a
+Real diff (FluxRegister const& a, FluxRegister const& b)
+{
+    Real dmax = 0.0;
+    Real amax = 0.0;
+    for (OrientationIter fi; fi; ++fi)
+    {
+        const Orientation face = fi();
+        for (FabSetIter fsi(a[face]); fsi.isValid(); ++fsi)
+        {
+            auto const& fa = a[face][fsi].const_array();
+            auto const& fb = b[face][fsi].const_array();
+            amrex::LoopOnCpu(fsi.validbox(), a.nComp(), [&] (int i, int j, int k, int n)
+            {
+                dmax = std::max(dmax, std::abs(fa(i,j,k,n) - fb(i,j,k,n)));
+                amax = std::max(amax, std::abs(fa(i,j,k,n)));
+            });
+        }
+    }
+    ParallelDescriptor::ReduceRealMax(dmax);
+    ParallelDescriptor::ReduceRealMax(amax);
+    return (amax > 0.0) ? dmax/amax : dmax;
+}
+
+Real diff (MultiFab const& a, MultiFab const& b)
+{
+    MultiFab d(a.boxArray(), a.DistributionMap(), a.nComp(), 0);
+    MultiFab::Copy(d, a, 0, 0, a.nComp(), 0);
+    MultiFab::Subtract(d, b, 0, 0, a.nComp(), 0);
+    return d.norm0(0, a.nComp(), IntVect(0)) / a.norm0(0, a.nComp(), IntVect(0));
+}
+
+// The flux times mult and area in components 0 to numcomp-1
+MultiFab scaledFlux (MultiFab const& mflx, MultiFab const& area, int srccomp, int numcomp,
+                     Real mult)
+{
+    MultiFab mf(mflx.boxArray(), mflx.DistributionMap(), numcomp, 0);
+    for (MFIter mfi(mflx); mfi.isValid(); ++mfi)
+    {
+        auto       dfab = mf.array(mfi);
+        auto const sfab = mflx.const_array(mfi);
+        auto const afab = area.const_array(mfi);
+        amrex::ParallelFor(mfi.validbox(), numcomp,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            dfab(i,j,k,n) = sfab(i,j,k,n+srccomp)*mult*afab(i,j,k);
+        });
+    }
+    return mf;
+}
+
+// FluxRegister::CrseInit one face at a time
+void refCrseInit (FluxRegister& fr, MultiFab const& mflx, MultiFab const& area, int dir,
+                  int srccomp, int destcomp, int numcomp, Real mult, FluxRegister::FrOp op)
+{
+    const MultiFab mf = scaledFlux(mflx, area, srccomp, numcomp, mult);
+    for (int s = 0; s < 2; ++s)
+    {
+        const Orientation face(dir, s == 0 ? Orientation::low : Orientation::high);
+        if (op == FluxRegister::COPY)
+        {
+            fr[face].copyFrom(mf, 0, 0, destcomp, numcomp);
+        }
+        else
+        {
+            FabSet fs(fr[face].boxArray(), fr[face].DistributionMap(), numcomp);
+            fs.setVal(0);
+            fs.copyFrom(mf, 0, 0, 0, numcomp);
+            fr[face].plusFrom(fs, 0, destcomp, numcomp);
+        }
+    }
+}
+
+// FluxRegister::CrseAdd one face at a time
+void refCrseAdd (FluxRegister& fr, MultiFab const& mflx, MultiFab const& area, int dir,
+                 int srccomp, int destcomp, int numcomp, Real mult, Geometry const& geom)
+{
+    const MultiFab mf = scaledFlux(mflx, area, srccomp, numcomp, mult);
+    for (int s = 0; s < 2; ++s)
+    {
+        const Orientation face(dir, s == 0 ? Orientation::low : Orientation::high);
+        fr[face].plusFrom(mf, 0, 0, destcomp, numcomp, geom.periodicity());
+    }
+}
+
+// FluxRegister::Reflux of one face
+void refReflux (FluxRegister const& fr, MultiFab& mf, MultiFab const& volume, Orientation face,
+                Real scale, int scomp, int dcomp, int nc, Geometry const& geom)
+{
+    const int idir = face.coordDir();
+    MultiFab flux(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
+                  mf.DistributionMap(), nc, 0);
+    flux.setVal(0.0);
+    fr[face].copyTo(flux, 0, scomp, 0, nc, geom.periodicity());
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        fluxreg_reflux(mfi.validbox(), mf.array(mfi), dcomp, flux.const_array(mfi),
+                       volume.const_array(mfi), nc, scale, face);
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 8;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+        }
+
+        const IntVect ratio(2);
+        const Box cdomain(IntVect(0), IntVect(n_cell-1));
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        const Geometry cgeom(cdomain, rb, CoordSys::cartesian, {AMREX_D_DECL(1,1,1)});
+
+        BoxArray cba(cdomain);
+        cba.maxSize(max_grid_size);
+        const DistributionMapping cdm(cba);
+
+        // Two fine grids that touch, and one at the domain corner whose
+        // faces are periodic images of each other's coarse cells.
+        const int q = n_cell/4;
+        BoxList fbl;
+        fbl.push_back(Box(IntVect(q), IntVect(AMREX_D_DECL(2*q-1, 3*q-1, 2*q-1))));
+        fbl.push_back(Box(IntVect(AMREX_D_DECL(2*q, q, q)), IntVect(AMREX_D_DECL(3*q-1, 2*q-1, 3*q-1))));
+        fbl.push_back(Box(IntVect(AMREX_D_DECL(3*q, 0, 0)), IntVect(AMREX_D_DECL(n_cell-1, q-1, q-1))));
+        BoxArray fba(fbl);
+        fba.refine(ratio);
+        fba.maxSize(2*max_grid_size);
+        const DistributionMapping fdm(fba);
+
+        // The register has ncomp components, the fluxes nflux, and only
+        // numcomp of them are moved.
+        const int ncomp = 4;
+        const int nflux = 5;
+        const int srccomp = 2;
+        const int destcomp = 1;
+        const int numcomp = 3;
+        const Real mult = -0.7;
+
+        Array<MultiFab,AMREX_SPACEDIM> cflux, carea, fflux;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const IntVect ixt = IntVect::TheDimensionVector(idim);
+            cflux[idim].define(amrex::convert(cba, ixt), cdm, nflux, 0);
+            carea[idim].define(amrex::convert(cba, ixt), cdm, 1, 0);
+            fflux[idim].define(amrex::convert(fba, ixt), fdm, nflux, 0);
+            fill(cflux[idim], idim);
+            fill(carea[idim], 10+idim, 3.0);
+            fill(fflux[idim], 20+idim);
+        }
+
+        FluxRegister fr(fba, fdm, ratio, 1, ncomp);
+        FluxRegister ref(fba, fdm, ratio, 1, ncomp);
+
+        amrex::Print() << "CrseInit\n";
+        for (FluxRegister::FrOp op : {FluxRegister::COPY, FluxRegister::ADD})
+        {
+            const std::string name = (op == FluxRegister::COPY) ? "COPY" : "ADD";
+            if (op == FluxRegister::COPY) {
+                fr.setVal(0.5);
+                ref.setVal(0.5);
+            }
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                fr.CrseInit(cflux[idim], carea[idim], idim, srccomp, destcomp, numcomp, mult, op);
+                refCrseInit(ref, cflux[idim], carea[idim], idim, srccomp, destcomp, numcomp, mult, op);
+            }
+            if (diff(fr, ref) != 0.0) {
+                amrex::Abort(name + " with area, not the same as one face at a time");
+            }
+
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                MultiFab ones(cflux[idim].boxArray(), cdm, 1, 0);
+                ones.setVal(1.0);
+                fr.CrseInit(cflux[idim], idim, srccomp-1, destcomp-1, numcomp, mult, op);
+                refCrseInit(ref, cflux[idim], ones, idim, srccomp-1, destcomp-1, numcomp, mult, op);
+            }
+            if (diff(fr, ref) != 0.0) {
+                amrex::Abort(name + " without area, not the same as one face at a time");
+            }
+        }
+
+        amrex::Print() << "CrseAdd\n";
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            fr.CrseAdd(cflux[idim], carea[idim], idim, srccomp, destcomp, numcomp, mult, cgeom);
+            refCrseAdd(ref, cflux[idim], carea[idim], idim, srccomp, destcomp, numcomp, mult, cgeom);
+        }
+        {
+            const Real d = diff(fr, ref);
+            amrex::Print() << "  relative difference " << d << "\n";
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(d <= 1.e-14, "same as one face at a time");
+        }
+
+        amrex::Print() << "Reflux\n";
+        // The same registers, with the fine fluxes added
+        for (OrientationIter fi; fi; ++fi) {
+            ref[fi()].copyFrom(fr[fi()], 0, 0, ncomp);
+        }
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            fr.FineAdd(fflux[idim], idim, 1, 0, ncomp, 0.25);
+            ref.FineAdd(fflux[idim], idim, 1, 0, ncomp, 0.25);
+        }
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(diff(fr, ref) == 0.0, "the same registers");
+
+        const int nstate = 6;
+        const int scomp = 1;
+        const int dcomp = 2;
+        const int nc = 3;
+        const Real scale = 0.9;
+        MultiFab state(cba, cdm, nstate, 0);
+        MultiFab state_ref(cba, cdm, nstate, 0);
+        MultiFab volume(cba, cdm, 1, 0);
+        fill(volume, 30, 3.0);
+
+        auto same_reflux = [&] (std::string const& what, auto&& reflux, auto&& ref_reflux)
+        {
+            fill(state, 40);
+            fill(state_ref, 40);
+            reflux();
+            ref_reflux();
+            const Real d = diff(state, state_ref);
+            amrex::Print() << "  " << what << ", relative difference " << d << "\n";
+            if (d > 1.e-14) {
+                amrex::Abort(what + ", not the same as one face at a time");
+            }
+        };
+
+        same_reflux("all faces",
+            [&] () { fr.Reflux(state, volume, scale, scomp, dcomp, nc, cgeom); },
+            [&] () {
+                for (OrientationIter fi; fi; ++fi) {
+                    refReflux(ref, state_ref, volume, fi(), scale, scomp, dcomp, nc, cgeom);
+                }
+            });
+
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            same_reflux("direction " + std::to_string(idim),
+                [&] () { fr.Reflux(state, volume, idim, scale, scomp, dcomp, nc, cgeom); },
+                [&] () {
+                    refReflux(ref, state_ref, volume, Orientation(idim, Orientation::low),
+                              scale, scomp, dcomp, nc, cgeom);
+                    refReflux(ref, state_ref, volume, Orientation(idim, Orientation::high),
+                              scale, scomp, dcomp, nc, cgeom);
+                });
+        }
+
+        const Orientation face(AMREX_SPACEDIM-1, Orientation::low);
+        same_reflux("one face",
+            [&] () { fr.Reflux(state, volume, face, scale, scomp, dcomp, nc, cgeom); },
+            [&] () { refReflux(ref, state_ref, volume, face, scale, scomp, dcomp, nc, cgeom); });
+
+        // The state without volume uses the cell volume of the geometry
+        same_reflux("all faces without volume",
+            [&] () { fr.Reflux(state, scale, scomp, dcomp, nc, cgeom); },
+            [&] () {
+                MultiFab vol(cba, cdm, 1, 0);
+                const Real* dx = cgeom.CellSize();
+                vol.setVal(AMREX_D_TERM(dx[0],*dx[1],*dx[2]));
+                for (OrientationIter fi; fi; ++fi) {
+                    refReflux(ref, state_ref, vol, fi(), scale, scomp, dcomp, nc, cgeom);
+                }
+            });
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,276 @@
+#include <AMReX.H>
+#include <AMReX_Amr.H>
+#include <AMReX_AmrLevel.H>
+#include <AMReX_LevelBld.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Interpolater.H>
+
+#include <cmath>
+#include <string>
+
+using namespace amrex;
+
+//
+// Checks a regrid with amr.regrid_keep_owners = 1 on a two-level
+// hierarchy whose fine grids follow a tagged box of the coarse level.  The
+// tagged box is shifted by half its length, so that half of the fine grids
+// stay.  Those must keep their owners, AmrLevel::FillFromOldLevel must move
+// their data, and the new data of all the fine grids must be the same as a
+// FillPatch from the old level.
+//
+
+extern "C" {
+    void amrex_probinit (const int* /*init*/,
+                         const int* /*name*/,
+                         const int* /*namelen*/,
+                         const amrex::Real* /*problo*/,
+                         const amrex::Real* /*probhi*/)
+    {}
+}
+
+namespace {
+
+constexpr int NComp = 2;
+
+// The coarse cells to refine
+Box tag_region;
+
+// What the last init(old) found
+struct InitFromOld
+{
+    int ncalls = 0;
+    int nmoved = 0;
+    Real max_diff = -1.0;
+} init_from_old;
+
+void nullfill (Box const& /*bx*/, FArrayBox& /*data*/,
+               const int /*dcomp*/, const int /*numcomp*/,
+               Geometry const& /*geom*/, const Real /*time*/,
+               const Vector<BCRec>& /*bcr*/, const int /*bcomp*/,
+               const int /*scomp*/)
+{}
+
+// A smooth function of the cell centers that differs between the levels,
+// so that coarse data interpolated to the fine level is told apart from
+// fine data.
+void fill (MultiFab& mf, Geometry const& geom, int lev)
+{
+    const auto plo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto const& a = mf.array(mfi);
+        amrex::ParallelFor(mfi.validbox(), mf.nComp(),
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            AMREX_D_TERM(const Real x = plo[0] + (i+Real(0.5))*dx[0];,
+                         const Real y = plo[1] + (j+Real(0.5))*dx[1];,
+                         const Real z = plo[2] + (k+Real(0.5))*dx[2];)
+            a(i,j,k,n) = (lev+1) * std::sin(Real(6.0)*x + n)
+                AMREX_D_TERM(, + std::cos(Real(5.0)*y), * std::sin(Real(4.0)*z - n));
+        });
+    }
+}
+
+class OwnerLevel
+    : public AmrLevel
+{
+public:
+
+    OwnerLevel () = default;
+
+    OwnerLevel (Amr& papa, int lev, const Geometry& level_geom, const BoxArray& ba,
+                const DistributionMapping& dm, Real time)
+        : AmrLevel(papa, lev, level_geom, ba, dm, time)
+    {}
+
+    static void variableSetUp ()
+    {
+        desc_lst.addDescriptor(0, IndexType::TheCellType(), StateDescriptor::Point,
+                               1, NComp, &cell_cons_interp);
+        BCRec bc(AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir),
+                 AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir));
+        for (int n = 0; n < NComp; ++n) {
+            desc_lst.setComponent(0, n, "phi"+std::to_string(n), bc,
+                                  StateDescriptor::BndryFunc(nullfill));
+        }
+    }
+
+    static void variableCleanUp ()
+    {
+        desc_lst.clear();
+        derive_lst.clear();
+    }
+
+    virtual void computeInitialDt (int finest_level, int /*sub_cycle*/, Vector<int>& /*n_cycle*/,
+                                   const Vector<IntVect>& /*ref_ratio*/, Vector<Real>& dt_level,
+                                   Real /*stop_time*/) override
+    {
+        for (int lev = 0; lev <= finest_level; ++lev) dt_level[lev] = 1.0;
+    }
+
+    virtual void computeNewDt (int finest_level, int sub_cycle, Vector<int>& n_cycle,
+                               const Vector<IntVect>& ref_ratio, Vector<Real>& /*dt_min*/,
+                               Vector<Real>& dt_level, Real stop_time,
+                               int /*post_regrid_flag*/) override
+    {
+        computeInitialDt(finest_level, sub_cycle, n_cycle, ref_ratio, dt_level, stop_time);
+    }
+
+    virtual Real advance (Real /*time*/, Real dt, int /*iteration*/, int /*ncycle*/) override
+    {
+        return dt;
+    }
+
+    virtual void post_timestep (int /*iteration*/) override {}
+    virtual void post_regrid (int /*lbase*/, int /*new_finest*/) override {}
+    virtual void post_init (Real /*stop_time*/) override {}
+
+    virtual void initData () override
+    {
+        fill(get_new_data(0), geom, level);
+    }
+
+    virtual void init (AmrLevel& old) override
+    {
+        MultiFab& S_new = get_new_data(0);
+        const Real cur_time = old.get_state_data(0).curTime();
+
+        // What FillPatch gives, before FillFromOldLevel takes the old data
+        MultiFab ref(grids, dmap, NComp, 0);
+        FillPatch(old, ref, 0, cur_time, 0, 0, NComp);
+
+        init_from_old.nmoved = FillFromOldLevel(old, cur_time, 0);
+        ++init_from_old.ncalls;
+
+        MultiFab::Subtract(ref, S_new, 0, 0, NComp, 0);
+        init_from_old.max_diff = ref.norm0(0, NComp, IntVect(0));
+    }
+
+    virtual void init () override
+    {
+        MultiFab& S_new = get_new_data(0);
+        const Real cur_time = parent->getLevel(level-1).get_state_data(0).curTime();
+        FillCoarsePatch(S_new, 0, cur_time, 0, 0, NComp);
+    }
+
+    virtual void errorEst (TagBoxArray& tags, int /*clearval*/, int tagval, Real /*time*/,
+                           int /*n_error_buf*/, int /*ngrow*/) override
+    {
+        if (level > 0) return;
+        for (MFIter mfi(tags); mfi.isValid(); ++mfi)
+        {
+            const Box bx = mfi.validbox() & tag_region;
+            if (bx.ok()) tags[mfi].setVal<RunOn::Host>(static_cast<TagBox::TagType>(tagval), bx);
+        }
+    }
+};
+
+class OwnerLevelBld
+    : public LevelBld
+{
+    virtual void variableSetUp () override { OwnerLevel::variableSetUp(); }
+    virtual void variableCleanUp () override { OwnerLevel::variableCleanUp(); }
+    virtual AmrLevel* operator() () override { return new OwnerLevel; }
+    virtual AmrLevel* operator() (Amr& papa, int lev, const Geometry& level_geom,
+                                  const BoxArray& ba, const DistributionMapping& dm,
+                                  Real time) override
+    {
+        return new OwnerLevel(papa, lev, level_geom, ba, dm, time);
+    }
+};
+
+OwnerLevelBld owner_bld;
+
+// Amr with regrid made public
+class TestAmr
+    : public Amr
+{
+public:
+    using Amr::Amr;
+    using Amr::regrid;
+};
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        {
+            ParmParse pp("amr");
+            int regrid_keep_owners = 0;
+            pp.query("regrid_keep_owners", regrid_keep_owners);
+            AMREX_ALWAYS_ASSERT(regrid_keep_owners == 1);
+        }
+
+        const Box tag0(IntVect(8), IntVect(23));
+        tag_region = tag0;
+
+        TestAmr amr(&owner_bld);
+        amr.init(0.0, -1.0);
+        AMREX_ALWAYS_ASSERT(amr.finestLevel() == 1);
+
+        // Fine data that are not an interpolation of the coarse data
+        fill(amr.getLevel(1).get_new_data(0), amr.Geom(1), 1);
+
+        const Real time = amr.cumTime();
+        const BoxArray old_ba = amr.boxArray(1);
+        const DistributionMapping old_dm = amr.DistributionMap(1);
+
+        // Half of the tagged box stays
+        const int shift = tag0.length(AMREX_SPACEDIM-1)/2;
+        tag_region = amrex::shift(tag0, AMREX_SPACEDIM-1, shift);
+        amrex::Print() << "Regrid with the tags shifted by " << shift << "\n";
+        amr.regrid(0, time);
+
+        const BoxArray& ba = amr.boxArray(1);
+        const DistributionMapping& dm = amr.DistributionMap(1);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(ba.contains(amrex::refine(tag_region, 2)) && ba != old_ba,
+                                         "new grids");
+
+        int nkept = 0;
+        bool same_owners = true;
+        for (int i = 0; i < ba.size(); ++i) {
+            for (int j = 0; j < old_ba.size(); ++j) {
+                if (ba[i] == old_ba[j]) {
+                    ++nkept;
+                    same_owners = same_owners && (dm[i] == old_dm[j]);
+                }
+            }
+        }
+        amrex::Print() << "  " << nkept << " of " << ba.size() << " grids stay\n";
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(nkept > 0 && nkept < ba.size(),
+                                         "some grids stay and some change");
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same_owners, "the grids that stay keep their owners");
+
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(init_from_old.ncalls == 1,
+                                         "the fine level is filled from the old one");
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(init_from_old.nmoved == nkept,
+                                         "FillFromOldLevel moves the grids that stay");
+        ParallelDescriptor::ReduceRealMax(init_from_old.max_diff);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(init_from_old.max_diff == 0.0,
+                                         "the data are the same as FillPatch");
+
+        // The data that moved are the old fine data, not an interpolation
+        // of the coarse data.
+        MultiFab expected(ba, dm, NComp, 0);
+        fill(expected, amr.Geom(1), 1);
+        MultiFab const& S_new = amr.getLevel(1).get_new_data(0);
+        Real kept_diff = 0.0;
+        for (MFIter mfi(S_new); mfi.isValid(); ++mfi) {
+            if (old_ba.contains(mfi.validbox())) {
+                auto const& a = S_new.const_array(mfi);
+                auto const& e = expected.const_array(mfi);
+                amrex::LoopOnCpu(mfi.validbox(), NComp, [&] (int i, int j, int k, int n)
+                {
+                    kept_diff = std::max(kept_diff, std::abs(a(i,j,k,n) - e(i,j,k,n)));
+                });
+            }
+        }
+        ParallelDescriptor::ReduceRealMax(kept_diff);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(kept_diff == 0.0,
+                                         "the grids that stay have the old fine data");
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,266 @@
+#include <AMReX.H>
+#include <AMReX_Amr.H>
+#include <AMReX_AmrLevel.H>
+#include <AMReX_LevelBld.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Interpolater.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+//
+// Checks Amr::regridDryRun and amr.regrid_skip_threshold on a two-level
+// hierarchy whose fine grids cover a tagged box of the coarse level
+// exactly.  The cell counts of the dry run are compared with those of the
+// tagged boxes, the dry run must leave the hierarchy alone, and a regrid
+// must be skipped when the churn is below the threshold and done when it
+// is above.
+//
+
+extern "C" {
+    void amrex_probinit (const int* /*init*/,
+                         const int* /*name*/,
+                         const int* /*namelen*/,
+                         const amrex::Real* /*problo*/,
+                         const amrex::Real* /*probhi*/)
+    {}
+}
+
+namespace {
+
+// The coarse cells to refine
+Box tag_region;
+
+void nullfill (Box const& /*bx*/, FArrayBox& /*data*/,
+               const int /*dcomp*/, const int /*numcomp*/,
+               Geometry const& /*geom*/, const Real /*time*/,
+               const Vector<BCRec>& /*bcr*/, const int /*bcomp*/,
+               const int /*scomp*/)
+{}
+
+class TagLevel
+    : public AmrLevel
+{
+public:
+
+    TagLevel () = default;
+
+    TagLevel (Amr& papa, int lev, const Geometry& level_geom, const BoxArray& ba,
+              const DistributionMapping& dm, Real time)
+        : AmrLevel(papa, lev, level_geom, ba, dm, time)
+    {}
+
+    static void variableSetUp ()
+    {
+        desc_lst.addDescriptor(0, IndexType::TheCellType(), StateDescriptor::Point,
+                               0, 1, &cell_cons_interp);
+        BCRec bc(AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir),
+                 AMREX_D_DECL(BCType::int_dir,BCType::int_dir,BCType::int_dir));
+        desc_lst.setComponent(0, 0, "phi", bc, StateDescriptor::BndryFunc(nullfill));
+    }
+
+    static void variableCleanUp ()
+    {
+        desc_lst.clear();
+        derive_lst.clear();
+    }
+
+    virtual void computeInitialDt (int finest_level, int /*sub_cycle*/, Vector<int>& /*n_cycle*/,
+                                   const Vector<IntVect>& /*ref_ratio*/, Vector<Real>& dt_level,
+                                   Real /*stop_time*/) override
+    {
+        for (int lev = 0; lev <= finest_level; ++lev) dt_level[lev] = 1.0;
+    }
+
+    virtual void computeNewDt (int finest_level, int sub_cycle, Vector<int>& n_cycle,
+                               const Vector<IntVect>& ref_ratio, Vector<Real>& /*dt_min*/,
+                               Vector<Real>& dt_level, Real stop_time,
+                               int /*post_regrid_flag*/) override
+    {
+        computeInitialDt(finest_level, sub_cycle, n_cycle, ref_ratio, dt_level, stop_time);
+    }
+
+    virtual Real advance (Real /*time*/, Real dt, int /*iteration*/, int /*ncycle*/) override
+    {
+        return dt;
+    }
+
+    virtual void post_timestep (int /*iteration*/) override {}
+    virtual void post_regrid (int /*lbase*/, int /*new_finest*/) override {}
+    virtual void post_init (Real /*stop_time*/) override {}
+
+    virtual void initData () override
+    {
+        get_new_data(0).setVal(1.0);
+    }
+
+    virtual void init (AmrLevel& old) override
+    {
+        MultiFab& S_new = get_new_data(0);
+        const Real cur_time = old.get_state_data(0).curTime();
+        FillPatch(old, S_new, 0, cur_time, 0, 0, 1);
+    }
+
+    virtual void init () override
+    {
+        MultiFab& S_new = get_new_data(0);
+        const Real cur_time = parent->getLevel(level-1).get_state_data(0).curTime();
+        FillCoarsePatch(S_new, 0, cur_time, 0, 0, 1);
+    }
+
+    virtual void errorEst (TagBoxArray& tags, int /*clearval*/, int tagval, Real /*time*/,
+                           int /*n_error_buf*/, int /*ngrow*/) override
+    {
+        if (level > 0) return;
+        for (MFIter mfi(tags); mfi.isValid(); ++mfi)
+        {
+            const Box bx = mfi.validbox() & tag_region;
+            if (bx.ok()) tags[mfi].setVal<RunOn::Host>(static_cast<TagBox::TagType>(tagval), bx);
+        }
+    }
+};
+
+class TagLevelBld
+    : public LevelBld
+{
+    virtual void variableSetUp () override { TagLevel::variableSetUp(); }
+    virtual void variableCleanUp () override { TagLevel::variableCleanUp(); }
+    virtual AmrLevel* operator() () override { return new TagLevel; }
+    virtual AmrLevel* operator() (Amr& papa, int lev, const Geometry& level_geom,
+                                  const BoxArray& ba, const DistributionMapping& dm,
+                                  Real time) override
+    {
+        return new TagLevel(papa, lev, level_geom, ba, dm, time);
+    }
+};
+
+TagLevelBld tag_bld;
+
+// Amr with regrid made public
+class TestAmr
+    : public Amr
+{
+public:
+    using Amr::Amr;
+    using Amr::regrid;
+};
+
+// The tagged box shifted by shift coarse cells in the last direction
+Box shifted (Box const& bx, int shift)
+{
+    return amrex::shift(bx, AMREX_SPACEDIM-1, shift);
+}
+
+Long fineCells (Box const& crse, Box const& crse_other)
+{
+    const Box b = amrex::refine(crse, 2) & amrex::refine(crse_other, 2);
+    return b.ok() ? b.numPts() : 0;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        Real regrid_skip_threshold = 0.0;
+        {
+            ParmParse pp("amr");
+            pp.get("regrid_skip_threshold", regrid_skip_threshold);
+        }
+
+        const Box tag0(IntVect(8), IntVect(23));
+        tag_region = tag0;
+
+        TestAmr amr(&tag_bld);
+        amr.init(0.0, -1.0);
+
+        AMREX_ALWAYS_ASSERT(amr.finestLevel() == 1);
+        const Real time = amr.cumTime();
+        const Long bytes_per_cell = sizeof(Real);
+        const BoxArray ba1 = amr.boxArray(1);
+        const DistributionMapping dm1 = amr.DistributionMap(1);
+
+        amrex::Print() << "Initial grids\n";
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(ba1.numPts() == fineCells(tag0, tag0) &&
+                                         ba1.contains(amrex::refine(tag0, 2)),
+                                         "the fine grids cover the tagged box");
+
+        amrex::Print() << "Dry run with the same tags\n";
+        {
+            const RegridMetrics m = amr.regridDryRun(0, time);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.start == 1 && m.new_finest == 1, "levels");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.grids[1] == ba1 && m.dmap[1] == dm1,
+                                             "same grids and distribution");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.old_cells[1] == ba1.numPts() &&
+                                             m.new_cells[1] == ba1.numPts() &&
+                                             m.overlap_cells[1] == ba1.numPts(), "cell counts");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.moved_cells[1] == 0 && m.totalMovedBytes() == 0,
+                                             "nothing moves");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.churn() == 0.0, "no churn");
+        }
+
+        // The churn of a shift by s coarse cells of a box of length n in the
+        // last direction is s/n.
+        const int n = tag0.length(AMREX_SPACEDIM-1);
+        const int small_shift = 4;
+        const int large_shift = 8;
+        AMREX_ALWAYS_ASSERT(Real(small_shift)/n < regrid_skip_threshold &&
+                            Real(large_shift)/n > regrid_skip_threshold);
+
+        amrex::Print() << "Dry run with the tags shifted by " << small_shift << "\n";
+        tag_region = shifted(tag0, small_shift);
+        {
+            const RegridMetrics m = amr.regridDryRun(0, time);
+            const Long ncells = fineCells(tag0, tag0);
+            const Long noverlap = fineCells(tag0, tag_region);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.new_finest == 1 && m.grids[1].numPts() == ncells &&
+                                             m.grids[1].contains(amrex::refine(tag_region, 2)),
+                                             "proposed grids");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.old_cells[1] == ncells && m.new_cells[1] == ncells &&
+                                             m.overlap_cells[1] == noverlap, "cell counts");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.moved_cells[1] <= m.overlap_cells[1] &&
+                                             m.moved_bytes[1] == m.moved_cells[1]*bytes_per_cell &&
+                                             m.totalMovedBytes() == m.moved_bytes[1],
+                                             "moved cells and bytes");
+            if (ParallelDescriptor::NProcs() == 1) {
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.moved_cells[1] == 0 && m.maxImbalance() == 1.0,
+                                                 "nothing moves on one process");
+            } else {
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m.imbalance[1] >= 1.0 &&
+                                                 m.imbalance[1] <= Real(ParallelDescriptor::NProcs()),
+                                                 "imbalance");
+            }
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(std::abs(m.churn() - Real(small_shift)/n) < 1.e-12,
+                                             "churn");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(amr.boxArray(1) == ba1 &&
+                                             amr.DistributionMap(1) == dm1,
+                                             "the hierarchy is unchanged");
+
+            // The metadata-only dry run of AmrMesh agrees on the counts.
+            const RegridMetrics mm = amr.RegridDryRun(0, time, bytes_per_cell);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(mm.new_cells[1] == ncells &&
+                                             mm.overlap_cells[1] == noverlap,
+                                             "AmrMesh::RegridDryRun");
+        }
+
+        amrex::Print() << "Regrid with the tags shifted by " << small_shift << "\n";
+        amr.regrid(0, time);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(amr.boxArray(1) == ba1 && amr.DistributionMap(1) == dm1,
+                                         "skipped below the threshold");
+
+        amrex::Print() << "Regrid with the tags shifted by " << large_shift << "\n";
+        tag_region = shifted(tag0, large_shift);
+        {
+            const RegridMetrics m = amr.regridDryRun(0, time);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(std::abs(m.churn() - Real(large_shift)/n) < 1.e-12,
+                                             "churn");
+            amr.regrid(0, time);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(amr.boxArray(1) == m.grids[1] &&
+                                             amr.DistributionMap(1) == m.dmap[1],
+                                             "done above the threshold, with the proposed grids");
+        }
+    }
+    amrex::Finalize();
+}
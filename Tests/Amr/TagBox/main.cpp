@@ -0,0 +1,289 @@
+// Checks the bit-packed host paths of TagBox::buffer, TagBox::coarsen and
+// TagBoxArray::collate against the byte loops they replaced, on random tag
+// patterns.  The patterns have rows across several 64-bit words, tags in
+// the ghost cells, boxes that are not aligned with the refinement ratio,
+// and tag values other than CLEAR, BUF and SET, such as the sums that
+// mapPeriodicRemoveDuplicates makes of tags across periodic boundaries.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_TagBox.H>
+
+#include <random>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+
+// Tags with probability density, some of them with values other than SET
+void fill (TagBox& tb, Box const& bx, Real density, std::mt19937& gen)
+{
+    std::uniform_real_distribution<Real> u(0.0, 1.0);
+    const TagBox::TagType odd[] = {TagBox::BUF, 3, 4, static_cast<TagBox::TagType>(-1)};
+    Array4<char> const& a = tb.array();
+    amrex::LoopOnCpu(bx, [&] (int i, int j, int k)
+    {
+        if (u(gen) < density) {
+            a(i,j,k) = (u(gen) < 0.7) ? TagBox::TagType(TagBox::SET)
+                                      : odd[static_cast<int>(u(gen)*4) % 4];
+        }
+    });
+}
+
+bool same (TagBox const& a, TagBox const& b)
+{
+    if (a.box() != b.box()) return false;
+    Array4<char const> const& aa = a.const_array();
+    Array4<char const> const& ba = b.const_array();
+    bool r = true;
+    amrex::LoopOnCpu(a.box(), [&] (int i, int j, int k)
+    {
+        r = r && (aa(i,j,k) == ba(i,j,k));
+    });
+    return r;
+}
+
+// TagBox::buffer on the host before the tags were bit-packed
+void refBuffer (TagBox& tb, IntVect const& a_nbuff, IntVect const& a_nwid)
+{
+    Box const& interior = amrex::grow(tb.box(), -a_nwid);
+    const Dim3 nbuf = a_nbuff.dim3();
+    Array4<char> const& a = tb.array();
+    AMREX_LOOP_3D(interior, i, j, k,
+    {
+        if (a(i,j,k) == TagBox::SET) {
+            for (int kk = k-nbuf.z; kk <= k+nbuf.z; ++kk) {
+            for (int jj = j-nbuf.y; jj <= j+nbuf.y; ++jj) {
+            for (int ii = i-nbuf.x; ii <= i+nbuf.x; ++ii) {
+                if (a(ii,jj,kk) == TagBox::CLEAR) { a(ii,jj,kk) = TagBox::BUF; }
+            }}}
+        }
+    });
+}
+
+// TagBox::coarsen on the host before the tags were bit-packed
+void refCoarsen (TagBox const& fine, IntVect const& ratio, TagBox& crse)
+{
+    Array4<char const> const& farr = fine.const_array();
+    Array4<char> const& carr = crse.array();
+    const Box fdomain = fine.box();
+    const Dim3 r = ratio.dim3();
+    AMREX_LOOP_3D(crse.box(), i, j, k,
+    {
+        TagBox::TagType t = TagBox::CLEAR;
+        for (int koff = 0; koff < r.z; ++koff) {
+            int kk = k*r.z + koff;
+            for (int joff = 0; joff < r.y; ++joff) {
+                int jj = j*r.y + joff;
+                for (int ioff = 0; ioff < r.x; ++ioff) {
+                    int ii = i*r.x + ioff;
+                    if (fdomain.contains(IntVect(AMREX_D_DECL(ii,jj,kk)))) {
+                        t = t || farr(ii,jj,kk);
+                    }
+                }
+            }
+        }
+        carr(i,j,k) = t;
+    });
+}
+
+// The tagged cells of the fabs, in the order of the fabs and their cells,
+// as TagBoxArray::collate gathered them one cell at a time
+void refLocalTags (TagBox const& tb, Vector<int>& cells)
+{
+    Array4<char const> const& a = tb.const_array();
+    amrex::LoopOnCpu(tb.box(), [&] (int i, int j, int k)
+    {
+        if (a(i,j,k) != TagBox::CLEAR) {
+            const IntVect iv(AMREX_D_DECL(i,j,k));
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) cells.push_back(iv[idim]);
+        }
+    });
+}
+
+// Compares the result of TagBoxArray::collate on the I/O process with the
+// local tags of all the processes.
+bool sameCollate (TagBoxArray const& tba, Vector<int> const& local_cells)
+{
+    Gpu::PinnedVector<IntVect> v;
+    tba.collate(v);
+
+    const int IOProc = ParallelDescriptor::IOProcessorNumber();
+    const int n = static_cast<int>(local_cells.size());
+    const std::vector<int> counts = ParallelDescriptor::Gather(n, IOProc);
+    std::vector<int> offsets(counts.size(), 0);
+    int total = 0;
+    if (ParallelDescriptor::IOProcessor()) {
+        for (int i = 0; i < static_cast<int>(counts.size()); ++i) {
+            offsets[i] = total;
+            total += counts[i];
+        }
+    }
+    Vector<int> all(std::max(total, 1));
+    ParallelDescriptor::Gatherv(local_cells.data(), n, all.data(), counts, offsets, IOProc);
+
+    bool r = true;
+    if (ParallelDescriptor::IOProcessor()) {
+        const int ntags = total / AMREX_SPACEDIM;
+        r = (ntags == 0) ? v.empty() : (static_cast<int>(v.size()) == ntags);
+        for (int t = 0; r && t < ntags; ++t) {
+            r = (v[t] == IntVect(&all[t*AMREX_SPACEDIM]));
+        }
+    }
+    ParallelDescriptor::ReduceBoolAnd(r);
+    return r;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int seed = 1234;
+        int nbuf = 2;
+        int ratio = 2;
+        {
+            ParmParse pp;
+            pp.query("seed", seed);
+            pp.query("nbuf", nbuf);
+            pp.query("ratio", ratio);
+        }
+
+        const Vector<Real> densities{0.01, 0.1, 0.5, 0.9};
+
+        amrex::Print() << "TagBox::buffer\n";
+        {
+            std::mt19937 gen(seed);
+            bool ok = true;
+            int ncases = 0;
+            for (int len : {5, 63, 64, 65, 130}) {
+            for (Real density : densities) {
+            for (IntVect const& nb : {IntVect(1), IntVect(2),
+                                      IntVect(AMREX_D_DECL(2,1,0)),
+                                      IntVect(AMREX_D_DECL(0,2,1))}) {
+                const IntVect nwid(2);
+                const Box bx(IntVect(AMREX_D_DECL(-3,2,1)),
+                             IntVect(AMREX_D_DECL(len-4,8,5)));
+                TagBox a(bx), b(bx);
+                a.setVal<RunOn::Host>(TagBox::CLEAR);
+                // Tags in the ghost cells, which must not be buffered
+                fill(a, bx, density, gen);
+                b.copy<RunOn::Host>(a);
+                a.buffer(nb, nwid);
+                refBuffer(b, nb, nwid);
+                ok = ok && same(a, b);
+                ++ncases;
+            }}}
+            if (!ok) {
+                amrex::Abort("not the same as the byte loop in " + std::to_string(ncases)
+                             + " cases");
+            }
+        }
+
+        amrex::Print() << "TagBox::coarsen\n";
+        {
+            std::mt19937 gen(seed+1);
+            bool ok = true;
+            int ncases = 0;
+            for (int len : {5, 63, 64, 65, 130}) {
+            for (Real density : densities) {
+            for (IntVect const& r : {IntVect(2), IntVect(4), IntVect(AMREX_D_DECL(4,2,3))}) {
+                // Not aligned with the ratio, so that the coarse cells at
+                // the edges are only partly covered.
+                const Box bx(IntVect(AMREX_D_DECL(-3,2,1)),
+                             IntVect(AMREX_D_DECL(len-4,12,9)));
+                const Box cbox = amrex::coarsen(bx, r);
+                TagBox a(bx);
+                a.setVal<RunOn::Host>(TagBox::CLEAR);
+                fill(a, bx, density, gen);
+                TagBox b(cbox);
+                refCoarsen(a, r, b);
+                a.coarsen(r, cbox);
+                ok = ok && same(a, b);
+                ++ncases;
+            }}}
+            if (!ok) {
+                amrex::Abort("not the same as the byte loop in " + std::to_string(ncases)
+                             + " cases");
+            }
+        }
+
+        // A periodic domain with rows of two words, and grids on both
+        // processes.
+        const Box domain(IntVect(0), IntVect(AMREX_D_DECL(79,23,15)));
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        const Geometry geom(domain, rb, CoordSys::cartesian, {AMREX_D_DECL(1,1,1)});
+        BoxArray ba(domain);
+        ba.maxSize(IntVect(AMREX_D_DECL(80,12,8)));
+        const DistributionMapping dm(ba);
+        const IntVect ngrow(nbuf);
+        const IntVect rr(ratio);
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            amrex::Print() << "TagBoxArray with "
+                           << (pass == 0 ? "tags in the valid cells"
+                                         : "tags in the valid and ghost cells") << "\n";
+            for (Real density : densities)
+            {
+                TagBoxArray tags(ba, dm, ngrow);
+                TagBoxArray ref(ba, dm, ngrow);
+                for (MFIter mfi(tags); mfi.isValid(); ++mfi) {
+                    std::mt19937 gen(seed + 7*mfi.index() + 1000*pass
+                                     + static_cast<int>(density*100));
+                    fill(tags[mfi], pass == 0 ? mfi.validbox() : mfi.fabbox(), density, gen);
+                    ref[mfi].copy<RunOn::Host>(tags[mfi]);
+                }
+
+                const std::string d = "density " + std::to_string(density) + ", ";
+
+                tags.buffer(ngrow);
+                bool ok = true;
+                for (MFIter mfi(tags); mfi.isValid(); ++mfi) {
+                    refBuffer(ref[mfi], ngrow, ngrow);
+                    ok = ok && same(tags[mfi], ref[mfi]);
+                }
+                ParallelDescriptor::ReduceBoolAnd(ok);
+                if (!ok) {
+                    amrex::Abort(d + "wrong buffer");
+                }
+
+                // Sums the tags across the periodic boundaries, which gives
+                // values other than CLEAR, BUF and SET.
+                tags.mapPeriodicRemoveDuplicates(geom);
+                ref.mapPeriodicRemoveDuplicates(geom);
+
+                Vector<int> cells;
+                for (MFIter mfi(ref); mfi.isValid(); ++mfi) refLocalTags(ref[mfi], cells);
+                if (!sameCollate(tags, cells)) {
+                    amrex::Abort(d + "wrong collate");
+                }
+
+                Vector<TagBox> crse;
+                const IntVect cgrow = (ngrow + rr - 1) / rr;
+                for (MFIter mfi(ref); mfi.isValid(); ++mfi) {
+                    crse.emplace_back(amrex::grow(amrex::coarsen(mfi.validbox(), rr), cgrow));
+                    refCoarsen(ref[mfi], rr, crse.back());
+                }
+                tags.coarsen(rr);
+                ok = true;
+                cells.clear();
+                for (MFIter mfi(tags); mfi.isValid(); ++mfi) {
+                    ok = ok && same(tags[mfi], crse[mfi.LocalIndex()]);
+                    refLocalTags(crse[mfi.LocalIndex()], cells);
+                }
+                ParallelDescriptor::ReduceBoolAnd(ok);
+                if (!ok) {
+                    amrex::Abort(d + "wrong coarsen");
+                }
+                if (!sameCollate(tags, cells)) {
+                    amrex::Abort(d + "wrong collate after coarsen");
+                }
+            }
+        }
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,220 @@
+// Checks that average_down_nowait and average_down_faces_nowait, finished
+// by average_down_finish, give bitwise the same coarse data as the
+// blocking average_down and average_down_faces, and as coarsening on the
+// fine layout followed by a ParallelCopy.  The coarse data live on grids
+// and a distribution that differ from the fine ones, so the copies go
+// through the network.  The handles are reused, also after the fine grids
+// change, and a handle destroyed while pending must finish its copies.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_MultiFabUtil.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+namespace {
+
+void fill (MultiFab& mf, int seed)
+{
+    const Real s = Real(seed);
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto const& a = mf.array(mfi);
+        amrex::ParallelFor(mfi.fabbox(), mf.nComp(),
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            a(i,j,k,n) = std::sin(Real(0.37)*i + s) * std::cos(Real(0.23)*j - n)
+                       + std::sin(Real(0.11)*k*(n+1) + s*Real(0.5));
+        });
+    }
+}
+
+bool same (MultiFab const& a, MultiFab const& b)
+{
+    MultiFab d(a.boxArray(), a.DistributionMap(), a.nComp(), 0);
+    MultiFab::Copy(d, a, 0, 0, a.nComp(), 0);
+    MultiFab::Subtract(d, b, 0, 0, a.nComp(), 0);
+    return d.norm0(0, a.nComp(), IntVect(0)) == Real(0.0);
+}
+
+// A coarse layout that is not a coarsened fine layout
+struct Layout
+{
+    BoxArray ba;
+    DistributionMapping dm;
+};
+
+Layout crseLayout (Box const& domain, int max_grid_size, IndexType ixt)
+{
+    BoxArray ba(domain);
+    ba.maxSize(max_grid_size);
+    // Round robin from the last rank, unlike the fine grids
+    Vector<int> pmap(ba.size());
+    const int nprocs = ParallelDescriptor::NProcs();
+    for (int i = 0; i < ba.size(); ++i) pmap[i] = (nprocs-1) - (i % nprocs);
+    return {amrex::convert(ba, ixt), DistributionMapping(pmap)};
+}
+
+// Coarsen on the fine layout, then copy, as average_down did before the
+// nowait version existed.
+void referenceAverageDown (MultiFab const& fine, MultiFab& crse, int scomp, int ncomp,
+                           IntVect const& ratio)
+{
+    MultiFab tmp(amrex::coarsen(fine.boxArray(), ratio), fine.DistributionMap(),
+                 fine.nComp(), 0);
+    tmp.setVal(0.0);
+    amrex::average_down(fine, tmp, scomp, ncomp, ratio);
+    crse.ParallelCopy(tmp, scomp, scomp, ncomp);
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 16;
+        int ncomp = 3;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("ncomp", ncomp);
+        }
+
+        const IntVect ratio(2);
+        const Box fdomain(IntVect(0), IntVect(n_cell-1));
+        const Box cdomain = amrex::coarsen(fdomain, ratio);
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        const Geometry cgeom(cdomain, rb, CoordSys::cartesian, {AMREX_D_DECL(1,1,1)});
+
+        BoxArray fba(fdomain);
+        fba.maxSize(max_grid_size);
+        const DistributionMapping fdm(fba);
+
+        for (IndexType ixt : {IndexType::TheCellType(), IndexType::TheNodeType()})
+        {
+            amrex::Print() << "average_down_nowait, "
+                           << (ixt.cellCentered() ? "cell-centered" : "nodal") << "\n";
+
+            MultiFab fine(amrex::convert(fba, ixt), fdm, ncomp, 0);
+            const Layout cl = crseLayout(cdomain, max_grid_size, ixt);
+            MultiFab crse(cl.ba, cl.dm, ncomp, 0);
+            MultiFab crse_blocking(cl.ba, cl.dm, ncomp, 0);
+            MultiFab crse_ref(cl.ba, cl.dm, ncomp, 0);
+
+            AverageDownHandle handle;
+            MultiFab const* tmp = nullptr;
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                fill(fine, pass);
+                crse.setVal(-1.0);
+                crse_blocking.setVal(-1.0);
+                crse_ref.setVal(-1.0);
+
+                average_down_nowait(fine, crse, 0, ncomp, ratio, handle);
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(handle.isPending(), "pending until finished");
+                // Independent work in between
+                amrex::average_down(fine, crse_blocking, 0, ncomp, ratio);
+                average_down_finish(handle);
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(!handle.isPending(), "finished");
+
+                referenceAverageDown(fine, crse_ref, 0, ncomp, ratio);
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(crse, crse_blocking),
+                                                 "same as the blocking average_down");
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(crse, crse_ref),
+                                                 "same as coarsening and copying");
+
+                MultiFab const* t = &handle.coarsenedTemp(0, amrex::coarsen(fine.boxArray(), ratio),
+                                                          fdm, ncomp, 0);
+                if (pass > 0) AMREX_ALWAYS_ASSERT_WITH_MESSAGE(t == tmp, "the temporary is reused");
+                tmp = t;
+            }
+
+            // Some of the components only, with the handle reused
+            fill(fine, 2);
+            crse.setVal(-1.0);
+            crse_ref.setVal(-1.0);
+            average_down_nowait(fine, crse, 1, ncomp-1, ratio, handle);
+            average_down_finish(handle);
+            referenceAverageDown(fine, crse_ref, 1, ncomp-1, ratio);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(crse, crse_ref), "components 1 and up");
+
+            // New fine grids with the same handle
+            BoxArray fba2(fdomain);
+            fba2.maxSize(max_grid_size/2);
+            MultiFab fine2(amrex::convert(fba2, ixt), DistributionMapping(fba2), ncomp, 0);
+            fill(fine2, 3);
+            crse.setVal(-1.0);
+            crse_ref.setVal(-1.0);
+            average_down_nowait(fine2, crse, 0, ncomp, ratio, handle);
+            average_down_finish(handle);
+            referenceAverageDown(fine2, crse_ref, 0, ncomp, ratio);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(crse, crse_ref), "new fine grids");
+
+            // A handle destroyed while pending
+            fill(fine, 4);
+            crse.setVal(-1.0);
+            crse_ref.setVal(-1.0);
+            {
+                AverageDownHandle h = average_down_nowait(fine, crse, 0, ncomp, ratio);
+            }
+            referenceAverageDown(fine, crse_ref, 0, ncomp, ratio);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same(crse, crse_ref), "finished by the destructor");
+        }
+
+        amrex::Print() << "average_down_faces_nowait\n";
+        {
+            Array<MultiFab,AMREX_SPACEDIM> fine;
+            Array<MultiFab,AMREX_SPACEDIM> crse;
+            Array<MultiFab,AMREX_SPACEDIM> crse_blocking;
+            Array<MultiFab,AMREX_SPACEDIM> crse_ref;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                const IndexType ixt(IntVect::TheDimensionVector(idim));
+                fine[idim].define(amrex::convert(fba, ixt), fdm, ncomp, 0);
+                const Layout cl = crseLayout(cdomain, max_grid_size, ixt);
+                crse[idim].define(cl.ba, cl.dm, ncomp, 0);
+                crse_blocking[idim].define(cl.ba, cl.dm, ncomp, 0);
+                crse_ref[idim].define(cl.ba, cl.dm, ncomp, 0);
+            }
+
+            AverageDownHandle handle;
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    fill(fine[idim], pass+idim);
+                    crse[idim].setVal(-1.0);
+                    crse_blocking[idim].setVal(-1.0);
+                    crse_ref[idim].setVal(-1.0);
+                }
+
+                average_down_faces_nowait(GetArrOfConstPtrs(fine), GetArrOfPtrs(crse),
+                                          ratio, cgeom, handle);
+                amrex::average_down_faces(GetArrOfConstPtrs(fine), GetArrOfPtrs(crse_blocking),
+                                          ratio, cgeom);
+                average_down_finish(handle);
+
+                // One direction at a time
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    amrex::average_down_faces(fine[idim], crse_ref[idim], ratio, cgeom);
+                }
+
+                bool ok_blocking = true;
+                bool ok_ref = true;
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    ok_blocking = ok_blocking && same(crse[idim], crse_blocking[idim]);
+                    ok_ref = ok_ref && same(crse[idim], crse_ref[idim]);
+                }
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(ok_blocking,
+                                                 "same as the blocking average_down_faces");
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(ok_ref, "same as one direction at a time");
+            }
+        }
+    }
+    amrex::Finalize();
+}
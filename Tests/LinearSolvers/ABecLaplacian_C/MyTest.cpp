@@ -2,6 +2,7 @@
 
 #include <AMReX_MLABecLaplacian.H>
 #include <AMReX_MLPoisson.H>
+#include <AMReX_GMRES_MLMG.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX_MultiFabUtil.H>
 
@@ -77,7 +78,17 @@ MyTest::solvePoisson ()
         }
 #endif
 
-        mlmg.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+        if (use_gmres) {
+            GMRESMLMG gmres(mlmg);
+            gmres.setVerbose(verbose);
+            gmres.setMaxIters(max_iter);
+            gmres.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+            if (gmres.getNumIters() >= max_iter) {
+                amrex::Abort("GMRESMLMG failed to converge");
+            }
+        } else {
+            mlmg.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+        }
     }
     else
     {
@@ -194,7 +205,17 @@ MyTest::solveABecLaplacian ()
         }
 #endif
 
-        mlmg.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+        if (use_gmres) {
+            GMRESMLMG gmres(mlmg);
+            gmres.setVerbose(verbose);
+            gmres.setMaxIters(max_iter);
+            gmres.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+            if (gmres.getNumIters() >= max_iter) {
+                amrex::Abort("GMRESMLMG failed to converge");
+            }
+        } else {
+            mlmg.solve(GetVecOfPtrs(solution), GetVecOfConstPtrs(rhs), tol_rel, tol_abs);
+        }
     }
     else
     {
@@ -432,6 +453,7 @@ MyTest::readParameters ()
     pp.query("semicoarsening", semicoarsening);
     pp.query("max_coarsening_level", max_coarsening_level);
     pp.query("max_semicoarsening_level", max_semicoarsening_level);
+    pp.query("use_gmres", use_gmres);
 
 #ifdef AMREX_USE_HYPRE
     pp.query("use_hypre", use_hypre);
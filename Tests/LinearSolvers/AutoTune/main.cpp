@@ -0,0 +1,126 @@
+// Checks the auto-tuning of MLMG on a Poisson problem.  The maximum
+// number of iterations is set to what the user's settings need, so that
+// the candidates with fewer smoothing sweeps fail to converge and the
+// solves have to fall back to the last good setting.  Every solve must
+// converge to the reference solution, and the settings kept at the end
+// must be among the candidates.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_MLPoisson.H>
+#include <AMReX_MLMG.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        int nsolves = 16;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nsolves", nsolves);
+        }
+        int autotune = 1;
+        int verbose = 1;
+        {
+            ParmParse pp("mlmg");
+            pp.query("autotune", autotune);
+            pp.query("verbose", verbose);
+        }
+
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        const Box domain(IntVect(0), IntVect(n_cell-1));
+        Geometry geom(domain, rb, CoordSys::cartesian, {AMREX_D_DECL(0,0,0)});
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        MultiFab rhs(ba, dm, 1, 0);
+        MultiFab phi(ba, dm, 1, 1);
+        MultiFab phi_ref(ba, dm, 1, 0);
+
+        const auto dx = geom.CellSizeArray();
+        for (MFIter mfi(rhs); mfi.isValid(); ++mfi)
+        {
+            auto const& a = rhs.array(mfi);
+            amrex::ParallelFor(mfi.validbox(),
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                const Real pi = Real(3.141592653589793);
+                AMREX_D_TERM(Real x = (i+Real(0.5))*dx[0];,
+                             Real y = (j+Real(0.5))*dx[1];,
+                             Real z = (k+Real(0.5))*dx[2];)
+                a(i,j,k) = AMREX_D_TERM(std::sin(pi*x), *std::sin(Real(2.)*pi*y),
+                                        *std::sin(Real(3.)*pi*z)) + Real(0.5)*std::cos(pi*x);
+                amrex::ignore_unused(j,k);
+            });
+        }
+        const Real rhs_norm = rhs.norm0();
+
+        MLPoisson linop({geom}, {ba}, {dm});
+        linop.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                        LinOpBCType::Dirichlet,
+                                        LinOpBCType::Dirichlet)},
+                          {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                        LinOpBCType::Dirichlet,
+                                        LinOpBCType::Dirichlet)});
+        linop.setLevelBC(0, nullptr);
+
+        const Real tol_rel = 1.e-10;
+
+        MLMG mlmg(linop);
+        mlmg.setVerbose(verbose);
+
+        // The user's settings, with no auto-tuning
+        phi.setVal(0.0);
+        mlmg.solve({&phi}, {&rhs}, tol_rel, 0.0);
+        MultiFab::Copy(phi_ref, phi, 0, 0, 1, 0);
+        const int niters = mlmg.getNumIters();
+        const int nu = mlmg.getPreSmooth();
+        amrex::Print() << "Reference solve: " << niters << " iterations\n";
+
+        mlmg.setMaxIter(niters);
+        mlmg.setAutoTune(autotune);
+
+        for (int isolve = 0; isolve < nsolves; ++isolve)
+        {
+            amrex::Print() << "Solve " << isolve << "\n";
+            phi.setVal(0.0);
+            const Real resnorm = mlmg.solve({&phi}, {&rhs}, tol_rel, 0.0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(resnorm <= tol_rel*rhs_norm, "converged");
+            MultiFab::Subtract(phi, phi_ref, 0, 0, 1, 0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(phi.norm0(0, 0) <= Real(1.e-8)*phi_ref.norm0(),
+                                             "same solution");
+        }
+
+        if (autotune) {
+            amrex::Print() << "Chosen settings\n";
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(mlmg.autoTuneDone(), "all the candidates tried");
+            const int nu1 = mlmg.getPreSmooth();
+            const int nu2 = mlmg.getPostSmooth();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(nu1 == nu2 && nu1 >= nu-1 && nu1 <= nu+2,
+                                             "smoothing sweeps");
+            bool extra_ok = true;
+            for (int n : mlmg.getExtraSmooth()) {
+                extra_ok = extra_ok && (n == 0 || n == 2 || n == 4);
+            }
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(extra_ok, "extra sweeps on the coarse levels");
+            const Real btol = mlmg.getBottomTolerance();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(btol == Real(1.e-4) || btol == Real(1.e-2) ||
+                                             btol == Real(1.e-1),
+                                             "bottom tolerance");
+            const int nfmg = mlmg.getMaxFmgIter();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(nfmg == 0 || nfmg == 1 || nfmg == niters, "F-cycles");
+        }
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,253 @@
+// Checks that the coefficients of an operator can be changed after a
+// solve, and that solving again with the same MLMG object, without a new
+// setup, gives the same solution as a new operator and solver built with
+// the new coefficients.  MLABecLaplacian (setScalars, setACoeffs and
+// setBCoeffs) and MLNodeLaplacian (setSigma) are tested on one and on two
+// AMR levels.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLNodeLaplacian.H>
+#include <AMReX_MLMG.H>
+
+#include <cmath>
+
+using namespace amrex;
+
+namespace {
+
+// a + b*f(x,y,z) on the cells or nodes of mf, with a different f for each seed
+void fill (MultiFab& mf, Geometry const& geom, Real a, Real b, int seed)
+{
+    const auto dx = geom.CellSizeArray();
+    const IntVect nodal = mf.ixType().toIntVect();
+    const Real s = Real(seed);
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto const& arr = mf.array(mfi);
+        amrex::ParallelFor(mfi.fabbox(),
+        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            const Real x = (i+Real(0.5)*(1-nodal[0]))*dx[0];
+            const Real y = (j+Real(0.5)*(1-nodal[1]))*dx[1];
+            const Real z = (k+Real(0.5)*(1-nodal[2]))*dx[2];
+            arr(i,j,k) = a + b*std::sin((Real(2.)+s)*x)*std::cos(Real(3.)*y+s)
+                               *std::sin(Real(4.)*z+x);
+        });
+    }
+}
+
+struct Hierarchy
+{
+    Vector<Geometry> geom;
+    Vector<BoxArray> grids;
+    Vector<DistributionMapping> dmap;
+    int nlevels () const { return geom.size(); }
+};
+
+Hierarchy makeHierarchy (int nlevels, int n_cell, int max_grid_size)
+{
+    Hierarchy h;
+    RealBox rb({0.,0.,0.}, {1.,1.,1.});
+    Box domain(IntVect(0), IntVect(n_cell-1));
+    for (int lev = 0; lev < nlevels; ++lev)
+    {
+        h.geom.emplace_back(domain, rb, CoordSys::cartesian, Array<int,3>{0,0,0});
+        // The finer level covers the middle half of the domain.
+        const Box bx = (lev == 0) ? domain : amrex::grow(domain, -domain.length(0)/4);
+        BoxArray ba(bx);
+        ba.maxSize(max_grid_size);
+        h.grids.push_back(ba);
+        h.dmap.emplace_back(ba);
+        domain.refine(2);
+    }
+    return h;
+}
+
+Vector<MultiFab> makeMFs (Hierarchy const& h, IndexType ixt, int ngrow)
+{
+    Vector<MultiFab> r(h.nlevels());
+    for (int lev = 0; lev < h.nlevels(); ++lev) {
+        r[lev].define(amrex::convert(h.grids[lev], ixt), h.dmap[lev], 1, ngrow);
+    }
+    return r;
+}
+
+void compareSolutions (Vector<MultiFab>& a, Vector<MultiFab> const& b,
+                       Vector<MultiFab> const& stale)
+{
+    Real diff = 0.0;
+    Real diff_stale = 0.0;
+    Real norm = 0.0;
+    for (int lev = 0; lev < static_cast<int>(a.size()); ++lev) {
+        MultiFab d(a[lev].boxArray(), a[lev].DistributionMap(), 1, 0);
+        MultiFab::Copy(d, a[lev], 0, 0, 1, 0);
+        MultiFab::Subtract(d, stale[lev], 0, 0, 1, 0);
+        diff_stale = std::max(diff_stale, d.norm0());
+        MultiFab::Copy(d, a[lev], 0, 0, 1, 0);
+        MultiFab::Subtract(d, b[lev], 0, 0, 1, 0);
+        diff = std::max(diff, d.norm0());
+        norm = std::max(norm, b[lev].norm0());
+    }
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(diff_stale > Real(1.e-3)*norm,
+                                     "the new coefficients change the solution");
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(diff <= Real(1.e-10)*norm, "same solution as a new operator");
+}
+
+void testABecLap (Hierarchy const& h)
+{
+    amrex::Print() << "MLABecLaplacian on " << h.nlevels() << " level(s)\n";
+
+    const Array<LinOpBCType,AMREX_SPACEDIM> bc{LinOpBCType::Dirichlet,
+                                               LinOpBCType::Neumann,
+                                               LinOpBCType::Dirichlet};
+    const Real tol_rel = 1.e-11;
+
+    auto setCoeffs = [&] (MLABecLaplacian& linop, int seed)
+    {
+        linop.setScalars(1.0+seed, 1.0);
+        for (int lev = 0; lev < h.nlevels(); ++lev) {
+            MultiFab acoef(h.grids[lev], h.dmap[lev], 1, 0);
+            fill(acoef, h.geom[lev], 2.0, 1.0, seed);
+            linop.setACoeffs(lev, acoef);
+            Array<MultiFab,AMREX_SPACEDIM> bcoef;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                bcoef[idim].define(amrex::convert(h.grids[lev], IntVect::TheDimensionVector(idim)),
+                                   h.dmap[lev], 1, 0);
+                fill(bcoef[idim], h.geom[lev], 1.5, 0.5+seed, seed);
+            }
+            linop.setBCoeffs(lev, amrex::GetArrOfConstPtrs(bcoef));
+        }
+    };
+
+    auto makeLinOp = [&] (MLABecLaplacian& linop, int seed)
+    {
+        linop.define(h.geom, h.grids, h.dmap);
+        linop.setDomainBC(bc, bc);
+        for (int lev = 0; lev < h.nlevels(); ++lev) {
+            linop.setLevelBC(lev, nullptr);
+        }
+        setCoeffs(linop, seed);
+    };
+
+    Vector<MultiFab> rhs0 = makeMFs(h, IndexType::TheCellType(), 0);
+    Vector<MultiFab> rhs1 = makeMFs(h, IndexType::TheCellType(), 0);
+    for (int lev = 0; lev < h.nlevels(); ++lev) {
+        fill(rhs0[lev], h.geom[lev], 0.0, 1.0, 0);
+        fill(rhs1[lev], h.geom[lev], 0.5, 1.0, 1);
+    }
+
+    // Solve, change the coefficients, and solve again with the same MLMG.
+    Vector<MultiFab> phi = makeMFs(h, IndexType::TheCellType(), 1);
+    MLABecLaplacian linop;
+    makeLinOp(linop, 0);
+    MLMG mlmg(linop);
+    mlmg.setVerbose(0);
+    for (auto& mf : phi) mf.setVal(0.0);
+    mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs0), tol_rel, 0.0);
+
+    // The old coefficients with the new right-hand side
+    Vector<MultiFab> phi_stale = makeMFs(h, IndexType::TheCellType(), 1);
+    for (auto& mf : phi_stale) mf.setVal(0.0);
+    mlmg.solve(GetVecOfPtrs(phi_stale), GetVecOfConstPtrs(rhs1), tol_rel, 0.0);
+
+    setCoeffs(linop, 1);
+    for (auto& mf : phi) mf.setVal(0.0);
+    mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs1), tol_rel, 0.0);
+
+    // A new operator and solver with the new coefficients
+    Vector<MultiFab> phi_new = makeMFs(h, IndexType::TheCellType(), 1);
+    MLABecLaplacian linop_new;
+    makeLinOp(linop_new, 1);
+    MLMG mlmg_new(linop_new);
+    mlmg_new.setVerbose(0);
+    for (auto& mf : phi_new) mf.setVal(0.0);
+    mlmg_new.solve(GetVecOfPtrs(phi_new), GetVecOfConstPtrs(rhs1), tol_rel, 0.0);
+
+    compareSolutions(phi, phi_new, phi_stale);
+}
+
+void testNodeLap (Hierarchy const& h)
+{
+    amrex::Print() << "MLNodeLaplacian on " << h.nlevels() << " level(s)\n";
+
+    const Real tol_rel = 1.e-11;
+
+    auto setSigma = [&] (MLNodeLaplacian& linop, int seed)
+    {
+        for (int lev = 0; lev < h.nlevels(); ++lev) {
+            MultiFab sigma(h.grids[lev], h.dmap[lev], 1, 0);
+            fill(sigma, h.geom[lev], 2.0, 1.0+seed, seed);
+            linop.setSigma(lev, sigma);
+        }
+    };
+
+    auto makeLinOp = [&] (MLNodeLaplacian& linop, int seed)
+    {
+        linop.define(h.geom, h.grids, h.dmap);
+        linop.setDomainBC({AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                        LinOpBCType::Neumann,
+                                        LinOpBCType::Dirichlet)},
+                          {AMREX_D_DECL(LinOpBCType::Dirichlet,
+                                        LinOpBCType::Neumann,
+                                        LinOpBCType::Dirichlet)});
+        setSigma(linop, seed);
+    };
+
+    Vector<MultiFab> rhs = makeMFs(h, IndexType::TheNodeType(), 0);
+    for (int lev = 0; lev < h.nlevels(); ++lev) {
+        fill(rhs[lev], h.geom[lev], 0.0, 1.0, 0);
+    }
+
+    auto zero = [] (Vector<MultiFab>& mfs) { for (auto& mf : mfs) mf.setVal(0.0); };
+
+    Vector<MultiFab> phi = makeMFs(h, IndexType::TheNodeType(), 1);
+    Vector<MultiFab> phi_stale = makeMFs(h, IndexType::TheNodeType(), 1);
+    MLNodeLaplacian linop;
+    makeLinOp(linop, 0);
+    MLMG mlmg(linop);
+    mlmg.setVerbose(0);
+    zero(phi_stale);
+    mlmg.solve(GetVecOfPtrs(phi_stale), GetVecOfConstPtrs(rhs), tol_rel, 0.0);
+
+    setSigma(linop, 1);
+    zero(phi);
+    mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs), tol_rel, 0.0);
+
+    Vector<MultiFab> phi_new = makeMFs(h, IndexType::TheNodeType(), 1);
+    MLNodeLaplacian linop_new;
+    makeLinOp(linop_new, 1);
+    MLMG mlmg_new(linop_new);
+    mlmg_new.setVerbose(0);
+    zero(phi_new);
+    mlmg_new.solve(GetVecOfPtrs(phi_new), GetVecOfConstPtrs(rhs), tol_rel, 0.0);
+
+    compareSolutions(phi, phi_new, phi_stale);
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+        }
+
+        for (int nlevels = 1; nlevels <= 2; ++nlevels)
+        {
+            const Hierarchy h = makeHierarchy(nlevels, n_cell, max_grid_size);
+            testABecLap(h);
+            testNodeLap(h);
+        }
+    }
+    amrex::Finalize();
+}
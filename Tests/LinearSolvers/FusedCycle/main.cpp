@@ -0,0 +1,173 @@
+// Checks that the fused residual-restriction and interpolation-smoothing
+// V-cycle of MLMG (MLMG::setFusedCycle) gives the same residual history
+// and the same solution as the unfused cycle, for MLPoisson and for
+// MLABecLaplacian with variable coefficients, on one and on two AMR
+// levels.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_MLPoisson.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+
+void fill (MultiFab& mf, Geometry const& geom, Real a, Real b)
+{
+    const auto dx = geom.CellSizeArray();
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto const& arr = mf.array(mfi);
+        amrex::ParallelFor(mfi.fabbox(),
+        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            const Real x = (i+Real(0.5))*dx[0];
+            const Real y = (j+Real(0.5))*dx[1];
+            const Real z = (k+Real(0.5))*dx[2];
+            arr(i,j,k) = a + b*std::sin(Real(3.)*x)*std::cos(Real(2.)*y)*std::sin(Real(5.)*z+x);
+        });
+    }
+}
+
+struct Hierarchy
+{
+    Vector<Geometry> geom;
+    Vector<BoxArray> grids;
+    Vector<DistributionMapping> dmap;
+};
+
+Hierarchy makeHierarchy (int nlevels, int n_cell, int max_grid_size)
+{
+    Hierarchy h;
+    RealBox rb({0.,0.,0.}, {1.,1.,1.});
+    Box domain(IntVect(0), IntVect(n_cell-1));
+    for (int lev = 0; lev < nlevels; ++lev)
+    {
+        h.geom.emplace_back(domain, rb, CoordSys::cartesian, Array<int,3>{0,0,0});
+        // The finer level covers the middle half of the domain.
+        const Box bx = (lev == 0) ? domain : amrex::grow(domain, -domain.length(0)/4);
+        BoxArray ba(bx);
+        ba.maxSize(max_grid_size);
+        h.grids.push_back(ba);
+        h.dmap.emplace_back(ba);
+        domain.refine(2);
+    }
+    return h;
+}
+
+template <class LinOp>
+std::pair<Vector<Real>,Vector<MultiFab>>
+solve (LinOp& linop, Hierarchy const& h, int fused, int verbose)
+{
+    const int nlevels = h.geom.size();
+    Vector<MultiFab> phi(nlevels);
+    Vector<MultiFab> rhs(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        phi[lev].define(h.grids[lev], h.dmap[lev], 1, 1);
+        rhs[lev].define(h.grids[lev], h.dmap[lev], 1, 0);
+        phi[lev].setVal(0.0);
+        fill(rhs[lev], h.geom[lev], 0.0, 1.0);
+    }
+
+    MLMG mlmg(linop);
+    mlmg.setVerbose(verbose);
+    mlmg.setFusedCycle(fused);
+    mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs), 1.e-10, 0.0);
+    return std::make_pair(mlmg.getResidualHistory(), std::move(phi));
+}
+
+template <class MakeLinOp>
+void compare (std::string const& name, Hierarchy const& h, MakeLinOp&& make_linop, int verbose)
+{
+    amrex::Print() << name << " on " << h.geom.size() << " level(s)\n";
+
+    auto linop_fused = make_linop();
+    auto fused = solve(*linop_fused, h, 1, verbose);
+    auto linop_unfused = make_linop();
+    auto unfused = solve(*linop_unfused, h, 0, verbose);
+
+    auto const& hf = fused.first;
+    auto const& hu = unfused.first;
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(hf.size() == hu.size(), "same number of iterations");
+    bool same_history = true;
+    for (int i = 0; i < std::min(hf.size(), hu.size()); ++i) {
+        same_history = same_history && std::abs(hf[i]-hu[i]) <= Real(1.e-8)*hu[0];
+    }
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(same_history, "same residual history");
+
+    Real diff = 0.0;
+    Real norm = 0.0;
+    for (int lev = 0; lev < static_cast<int>(h.geom.size()); ++lev) {
+        MultiFab::Subtract(fused.second[lev], unfused.second[lev], 0, 0, 1, 0);
+        diff = std::max(diff, fused.second[lev].norm0());
+        norm = std::max(norm, unfused.second[lev].norm0());
+    }
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(diff <= Real(1.e-9)*norm, "same solution");
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        int verbose = 0;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("verbose", verbose);
+        }
+
+        const Array<LinOpBCType,AMREX_SPACEDIM> bc{LinOpBCType::Dirichlet,
+                                                   LinOpBCType::Neumann,
+                                                   LinOpBCType::Dirichlet};
+
+        for (int nlevels = 1; nlevels <= 2; ++nlevels)
+        {
+            const Hierarchy h = makeHierarchy(nlevels, n_cell, max_grid_size);
+
+            compare("MLPoisson", h, [&] ()
+            {
+                auto linop = std::make_unique<MLPoisson>(h.geom, h.grids, h.dmap);
+                linop->setDomainBC(bc, bc);
+                for (int lev = 0; lev < nlevels; ++lev) {
+                    linop->setLevelBC(lev, nullptr);
+                }
+                return linop;
+            }, verbose);
+
+            compare("MLABecLaplacian", h, [&] ()
+            {
+                auto linop = std::make_unique<MLABecLaplacian>(h.geom, h.grids, h.dmap);
+                linop->setDomainBC(bc, bc);
+                linop->setScalars(1.0, 1.0);
+                for (int lev = 0; lev < nlevels; ++lev) {
+                    linop->setLevelBC(lev, nullptr);
+                    MultiFab acoef(h.grids[lev], h.dmap[lev], 1, 0);
+                    fill(acoef, h.geom[lev], 2.0, 1.0);
+                    linop->setACoeffs(lev, acoef);
+                    Array<MultiFab,AMREX_SPACEDIM> bcoef;
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        bcoef[idim].define(amrex::convert(h.grids[lev], IntVect::TheDimensionVector(idim)),
+                                           h.dmap[lev], 1, 0);
+                        fill(bcoef[idim], h.geom[lev], 1.5, 0.5);
+                    }
+                    linop->setBCoeffs(lev, amrex::GetArrOfConstPtrs(bcoef));
+                }
+                return linop;
+            }, verbose);
+        }
+    }
+    amrex::Finalize();
+}
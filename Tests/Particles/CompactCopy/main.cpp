@@ -0,0 +1,187 @@
+// Round trip of the particles of every tile through a CompactParticleCopy,
+// with every other real component narrowed to single precision, for a
+// container with struct, SoA and runtime components and for a pure SoA
+// container.  The domain is far from the origin, so that the positions
+// only keep their precision by being stored relative to the tile.  The
+// positions must come back within single precision of the tile size, the
+// narrowed components rounded to single precision, and the ids, cpus, ints
+// and the other real components exactly.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_Particles.H>
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+
+// Gives every component of every particle a value of its own
+template <class PC>
+void setComponents (PC& pc)
+{
+    using ParIter = typename PC::ParIterType;
+    for (int lev = 0; lev <= pc.finestLevel(); ++lev) {
+        for (ParIter pti(pc, lev); pti.isValid(); ++pti)
+        {
+            const auto ptd = pti.GetParticleTile().getParticleTileData();
+            AMREX_FOR_1D ( pti.numParticles(), i,
+            {
+                auto p = ptd.getSuperParticle(i);
+                const Long id = p.id();
+                for (int j = 0; j < PC::SuperParticleType::NReal; ++j) {
+                    p.rdata(j) = std::sin(ParticleReal(0.37)*ParticleReal(id) + j);
+                }
+                for (int j = 0; j < PC::SuperParticleType::NInt; ++j) {
+                    p.idata(j) = (j % 2) ? -static_cast<int>(id) : static_cast<int>(id)*7 + j;
+                }
+                ptd.setSuperParticle(p, i);
+                for (int j = 0; j < ptd.m_num_runtime_real; ++j) {
+                    ptd.m_runtime_rdata[j][i] = std::cos(ParticleReal(0.11)*ParticleReal(id) + j);
+                }
+                for (int j = 0; j < ptd.m_num_runtime_int; ++j) {
+                    ptd.m_runtime_idata[j][i] = static_cast<int>(id) + 1000*j;
+                }
+            });
+        }
+    }
+}
+
+template <class PC>
+void roundTrip (PC& pc, const std::string& name)
+{
+    using PTile = typename PC::ParticleTileType;
+    using CopyType = CompactParticleCopy<PTile>;
+    constexpr int NSR = PC::NStructReal;
+    constexpr int NSI = PC::NStructInt;
+    constexpr int NAR = PC::NArrayReal;
+    constexpr int NAI = PC::NArrayInt;
+
+    Vector<int> narrow_real(NSR + NAR + pc.NumRuntimeRealComps());
+    for (int j = 0; j < narrow_real.size(); ++j) narrow_real[j] = j % 2;
+
+    Long np_checked = 0;
+    for (int lev = 0; lev <= pc.finestLevel(); ++lev)
+    {
+        const auto& plev = pc.GetParticles(lev);
+        const auto dx = pc.Geom(lev).CellSizeArray();
+        for (MFIter mfi = pc.MakeMFIter(lev); mfi.isValid(); ++mfi)
+        {
+            const auto ptile_it = plev.find(std::make_pair(mfi.index(), mfi.LocalTileIndex()));
+            if (ptile_it == plev.end()) continue;
+            const auto& ptile = ptile_it->second;
+            const Box& tbx = mfi.tilebox();
+            const int np = ptile.numParticles();
+
+            CopyType ccopy;
+            ccopy.compact(ptile, tbx, pc.Geom(lev), narrow_real);
+            AMREX_ALWAYS_ASSERT(ccopy.numParticles() == np);
+
+            PTile ptile2;
+            ptile2.define(pc.NumRuntimeRealComps(), pc.NumRuntimeIntComps());
+            ccopy.expand(ptile2);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(ptile2.numParticles() == np,
+                                             "expand changed the number of particles");
+
+            // The offset from the tile corner is at most the tile size in
+            // cells, and it is rounded to single precision.
+            GpuArray<ParticleReal,AMREX_SPACEDIM> tol;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                tol[idim] = ParticleReal(tbx.length(idim)+1) * ParticleReal(dx[idim])
+                    * ParticleReal(std::numeric_limits<float>::epsilon());
+            }
+
+            const auto ptd = ptile.getConstParticleTileData();
+            const auto ptd2 = ptile2.getConstParticleTileData();
+            const CopyType& cccopy = ccopy;
+            const auto cptd = cccopy.getTileData();
+            AMREX_FOR_1D ( np, i,
+            {
+                AMREX_ALWAYS_ASSERT(ptd2.id(i) == ptd.id(i) && cptd.id(i) == ptd.id(i));
+                AMREX_ALWAYS_ASSERT(ptd2.cpu(i) == ptd.cpu(i) && cptd.cpu(i) == ptd.cpu(i));
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    AMREX_ALWAYS_ASSERT(amrex::Math::abs(ptd2.pos(idim,i)-ptd.pos(idim,i)) <= tol[idim]);
+                    AMREX_ALWAYS_ASSERT(amrex::Math::abs(cptd.pos(idim,i)-ptd.pos(idim,i)) <= tol[idim]);
+                }
+
+                const auto p = ptd.getSuperParticle(i);
+                const auto p2 = ptd2.getSuperParticle(i);
+                for (int j = 0; j < NSR+NAR; ++j) {
+                    const ParticleReal r = p.rdata(j);
+                    const ParticleReal expected = (j % 2) ? static_cast<float>(r) : r;
+                    AMREX_ALWAYS_ASSERT(p2.rdata(j) == expected && cptd.rdata(j,i) == expected);
+                }
+                for (int j = 0; j < ptd.m_num_runtime_real; ++j) {
+                    const ParticleReal r = ptd.m_runtime_rdata[j][i];
+                    const ParticleReal expected = ((NSR+NAR+j) % 2) ? static_cast<float>(r) : r;
+                    AMREX_ALWAYS_ASSERT(ptd2.m_runtime_rdata[j][i] == expected);
+                    AMREX_ALWAYS_ASSERT(cptd.rdata(NSR+NAR+j,i) == expected);
+                }
+                for (int j = 0; j < NSI+NAI; ++j) {
+                    AMREX_ALWAYS_ASSERT(p2.idata(j) == p.idata(j) && cptd.idata(j,i) == p.idata(j));
+                }
+                for (int j = 0; j < ptd.m_num_runtime_int; ++j) {
+                    AMREX_ALWAYS_ASSERT(ptd2.m_runtime_idata[j][i] == ptd.m_runtime_idata[j][i]);
+                    AMREX_ALWAYS_ASSERT(cptd.idata(NSI+NAI+j,i) == ptd.m_runtime_idata[j][i]);
+                }
+            });
+            np_checked += np;
+        }
+    }
+
+    ParallelDescriptor::ReduceLongSum(np_checked);
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(np_checked == pc.TotalNumberOfParticles(),
+                                     "not every particle went through the round trip");
+    amrex::Print() << name << ": " << np_checked << " particles round-tripped\n";
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 16;
+        int nppc = 2;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+        }
+
+        // A unit domain far from the origin
+        const Real x0 = 1.e4;
+        RealBox rb({AMREX_D_DECL(x0,x0,x0)}, {AMREX_D_DECL(x0+1.,x0+1.,x0+1.)});
+        const Box domain(IntVect(0), IntVect(n_cell-1));
+        Geometry geom(domain, rb, CoordSys::cartesian, {AMREX_D_DECL(1,1,1)});
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        {
+            using PC = ParticleContainer<2, 2, 3, 2>;
+            PC pc(geom, dm, ba);
+            pc.AddRealComp(true);
+            pc.AddRealComp(true);
+            pc.AddIntComp(true);
+            pc.InitNRandomPerCell(nppc, PC::ParticleInitData{});
+            setComponents(pc);
+            roundTrip(pc, "struct, SoA and runtime components");
+        }
+
+        {
+            using PC = ParticleContainerPureSoA<3, 2>;
+            PC pc(geom, dm, ba);
+            pc.InitNRandomPerCell(nppc, PC::ParticleInitData{});
+            setComponents(pc);
+            roundTrip(pc, "pure SoA");
+        }
+    }
+    amrex::Finalize();
+}
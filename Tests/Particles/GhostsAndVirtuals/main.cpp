@@ -726,6 +726,129 @@ void test_ghosts_and_virtuals_onepercell (TestParams& parms)
     }
 }
 
+template <class PC>
+Real mass_sum (PC const& pc)
+{
+    using PType = typename PC::SuperParticleType;
+    Real sum = amrex::ReduceSum(pc,
+        [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Real
+        {
+            return p.rdata(0);
+        }
+    );
+    amrex::ParallelAllReduce::Sum(sum,ParallelContext::CommunicatorSub());
+    return sum;
+}
+
+// The virtual and ghost particles of a pure SoA container, which keeps the
+// mass in the struct-of-arrays, must match those of the AoS container.
+void test_ghosts_and_virtuals_pure_soa (TestParams& parms)
+{
+    int nlevs = parms.nlevs;
+
+    RealBox real_box;
+    for (int n = 0; n < BL_SPACEDIM; n++) {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 1.0);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0 , 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(parms.nx - 1, parms.ny - 1, parms.nz-1));
+    const Box domain(domain_lo, domain_hi);
+
+    Vector<int> rr(nlevs);
+    for (int lev = 1; lev < nlevs; lev++)
+        rr.at(lev-1) = 2;
+
+    std::array<int, BL_SPACEDIM> is_per;
+    for (int i = 0; i < BL_SPACEDIM; i++)
+        is_per.at(i) = 1;
+
+    Vector<Geometry> geom(nlevs);
+    geom[0].define(domain, &real_box, CoordSys::cartesian, is_per.data());
+    for (int lev = 1; lev < nlevs; lev++) {
+        geom.at(lev).define(amrex::refine(geom.at(lev-1).Domain(), rr.at(lev-1)),
+                            &real_box, CoordSys::cartesian, is_per.data());
+    }
+
+    Vector<BoxArray> ba(nlevs);
+    ba.at(0).define(domain);
+
+    int n_fine = parms.nx;
+    for (int lev = 1; lev < nlevs; lev++) {
+        n_fine *= rr.at(lev-1);
+        IntVect refined_lo(AMREX_D_DECL(n_fine/4,n_fine/4,n_fine/4));
+        IntVect refined_hi(AMREX_D_DECL(3*n_fine/4-1,3*n_fine/4-1,3*n_fine/4-1));
+        Box refined_patch(refined_lo, refined_hi);
+        ba.at(lev).define(refined_patch);
+    }
+
+    for (int lev = 0; lev < nlevs; lev++) {
+        ba.at(lev).maxSize(parms.max_grid_size);
+    }
+
+    Vector<DistributionMapping> dmap(nlevs);
+    for (int lev = 0; lev < nlevs; lev++) {
+        dmap.at(lev) = DistributionMapping{ba.at(lev)};
+    }
+
+    typedef AmrParticleContainer<1, 0, 0, 0> AoSContainer;
+    typedef AmrParticleContainer<0, 0, 1, 0, DefaultAllocator, true> SoAContainer;
+
+    int num_particles = parms.nppc * AMREX_D_TERM(parms.nx, * parms.ny, * parms.nz);
+    bool serialize = true;
+    int iseed = 451;
+    double mass = 10.0;
+
+    AoSContainer aosPC(geom, dmap, ba, rr);
+    AoSContainer::ParticleInitData aos_pdata = {{mass}, {}, {}, {}};
+    aosPC.InitRandom(num_particles, iseed, aos_pdata, serialize);
+
+    SoAContainer soaPC(geom, dmap, ba, rr);
+    SoAContainer::ParticleInitData soa_pdata = {{}, {}, {mass}, {}};
+    soaPC.InitRandom(num_particles, iseed, soa_pdata, serialize);
+
+    AMREX_ALWAYS_ASSERT(soaPC.TotalNumberOfParticles() == aosPC.TotalNumberOfParticles());
+    AMREX_ALWAYS_ASSERT(mass_sum(soaPC) == mass_sum(aosPC));
+
+    {
+        AoSContainer aosVirtPC(geom, dmap, ba, rr);
+        AoSContainer::ParticleTileType aos_virts;
+        aosPC.CreateVirtualParticles(nlevs-1, aos_virts);
+        aosVirtPC.AddParticlesAtLevel(aos_virts, 0);
+
+        SoAContainer soaVirtPC(geom, dmap, ba, rr);
+        SoAContainer::ParticleTileType soa_virts;
+        soaPC.CreateVirtualParticles(nlevs-1, soa_virts);
+        soaVirtPC.AddParticlesAtLevel(soa_virts, 0);
+
+        amrex::Print()<<"Found "<<soaVirtPC.TotalNumberOfParticles()<<" pure SoA virts"<<std::endl;
+        AMREX_ALWAYS_ASSERT(soaVirtPC.TotalNumberOfParticles() == aosVirtPC.TotalNumberOfParticles());
+        AMREX_ALWAYS_ASSERT(mass_sum(soaVirtPC) == mass_sum(aosVirtPC));
+    }
+
+    {
+        const int ngrow = 1;
+        const int src_lev = 0;
+        const int dst_lev = 1;
+
+        AoSContainer aosGhostPC(geom, dmap, ba, rr);
+        AoSContainer::AoS aos_ghosts;
+        aosPC.CreateGhostParticles(src_lev, ngrow, aos_ghosts);
+        aosGhostPC.AddParticlesAtLevel(aos_ghosts, dst_lev, ngrow);
+
+        // The AoS overloads gather the particles of a pure SoA tile into
+        // structs and back.
+        SoAContainer soaGhostPC(geom, dmap, ba, rr);
+        SoAContainer::AoS soa_ghosts;
+        soaPC.CreateGhostParticles(src_lev, ngrow, soa_ghosts);
+        soaGhostPC.AddParticlesAtLevel(soa_ghosts, dst_lev, ngrow);
+
+        amrex::Print()<<"Found "<<soaGhostPC.TotalNumberOfParticles()<<" pure SoA ghosts"<<std::endl;
+        AMREX_ALWAYS_ASSERT(soaGhostPC.TotalNumberOfParticles() == aosGhostPC.TotalNumberOfParticles());
+    }
+}
+
 int main(int argc, char* argv[])
 {
   amrex::Initialize(argc,argv);
@@ -771,5 +894,8 @@ int main(int argc, char* argv[])
   amrex::Print()<<"OnePerCell test"<<std::endl;
   test_ghosts_and_virtuals_onepercell(parms);
 
+  amrex::Print()<<"Pure SoA test"<<std::endl;
+  test_ghosts_and_virtuals_pure_soa(parms);
+
   amrex::Finalize();
 }
@@ -0,0 +1,249 @@
+// Checks the near-grid path of Redistribute, which locates a particle that
+// is still in its grid, or that moved into a grid touching it, with a few
+// box tests.  The particles are moved just across the faces of their grids,
+// including the periodic boundaries, onto the faces, and by less than a
+// cell, and after each Redistribute every particle must be in the grid and
+// tile that the full BoxArray search of Where finds.  The cached near grids
+// and neighbor ranks must match the grids, also after the grids or their
+// distribution change.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_Particles.H>
+
+#include <algorithm>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+
+class NearGridContainer
+    : public ParticleContainer<1,0>
+{
+public:
+
+    using ParticleContainer<1,0>::ParticleContainer;
+    using ParticleContainer<1,0>::Where;
+
+    // For each local grid, the grids touching it, sorted
+    std::map<int, Vector<int> > nearGrids (int lev) const
+    {
+        BuildNearGrids();
+        std::map<int, Vector<int> > r;
+        for (auto const& kv : m_near_grids[lev]) {
+            auto& v = r[kv.first];
+            for (auto const& nb : kv.second.nbors) v.push_back(nb.first);
+            std::sort(v.begin(), v.end());
+        }
+        return r;
+    }
+
+    bool allNoFiner (int lev) const
+    {
+        BuildNearGrids();
+        bool r = true;
+        for (auto const& kv : m_near_grids[lev]) r = r && kv.second.no_finer;
+        return r;
+    }
+};
+
+void initParticles (NearGridContainer& pc, int nppc)
+{
+    const auto plo = pc.Geom(0).ProbLoArray();
+    const auto dx = pc.Geom(0).CellSizeArray();
+    for (MFIter mfi = pc.MakeMFIter(0); mfi.isValid(); ++mfi)
+    {
+        auto& ptile = pc.DefineAndReturnParticleTile(0, mfi.index(), mfi.LocalTileIndex());
+        amrex::LoopOnCpu(mfi.tilebox(), [&] (int i, int j, int k)
+        {
+            const IntVect iv(AMREX_D_DECL(i,j,k));
+            for (int n = 0; n < nppc; ++n) {
+                NearGridContainer::ParticleType p;
+                p.id() = NearGridContainer::ParticleType::NextID();
+                p.cpu() = ParallelDescriptor::MyProc();
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    p.pos(idim) = plo[idim] + (iv[idim] + amrex::Random())*dx[idim];
+                }
+                p.rdata(0) = Real(p.id());
+                ptile.push_back(p);
+            }
+        });
+    }
+}
+
+// Moves every third particle just across a face of its grid, every sixth
+// exactly onto the high face of its grid, and the others by less than a
+// cell in every direction.  The faces of the grids at the domain boundary
+// are periodic boundaries.
+void moveParticles (NearGridContainer& pc)
+{
+    const auto plo = pc.Geom(0).ProbLoArray();
+    const auto dx = pc.Geom(0).CellSizeArray();
+    const BoxArray& ba = pc.ParticleBoxArray(0);
+    for (NearGridContainer::ParIterType pti(pc, 0); pti.isValid(); ++pti)
+    {
+        const Box& gbx = ba[pti.index()];
+        for (auto& p : pti.GetArrayOfStructs())
+        {
+            if (p.id() % 6 == 0) {
+                const int d = static_cast<int>(amrex::Random_int(AMREX_SPACEDIM));
+                p.pos(d) = plo[d] + (gbx.bigEnd(d)+1)*dx[d];
+            } else if (p.id() % 3 == 0) {
+                const int d = static_cast<int>(amrex::Random_int(AMREX_SPACEDIM));
+                const Real lo = plo[d] + gbx.smallEnd(d)*dx[d];
+                const Real hi = plo[d] + (gbx.bigEnd(d)+1)*dx[d];
+                const Real eps = Real(1.e-3)*dx[d];
+                p.pos(d) = (p.pos(d)-lo < hi-p.pos(d)) ? lo - eps : hi + eps;
+            } else {
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    p.pos(d) += Real(1.5)*(amrex::Random() - Real(0.5))*dx[d];
+                }
+            }
+        }
+    }
+}
+
+// Whether every particle is in the grid and tile that Where finds
+bool inWhereTile (NearGridContainer const& pc)
+{
+    bool ok = true;
+    for (auto const& kv : pc.GetParticles(0))
+    {
+        const int gid = kv.first.first;
+        const int tid = kv.first.second;
+        for (auto const& p : kv.second.GetArrayOfStructs()) {
+            ParticleLocData pld;
+            ok = ok && pc.Where(p, pld) && pld.m_lev == 0 && pld.m_grid == gid && pld.m_tile == tid;
+        }
+    }
+    ParallelDescriptor::ReduceBoolAnd(ok);
+    return ok;
+}
+
+// The number of particles and the sum of their ids, which the particles
+// carry in rdata(0) too
+std::pair<Long,Real> census (NearGridContainer const& pc)
+{
+    Long n = 0;
+    Real s = 0.0;
+    for (auto const& kv : pc.GetParticles(0)) {
+        for (auto const& p : kv.second.GetArrayOfStructs()) {
+            ++n;
+            s += p.rdata(0);
+            if (p.rdata(0) != Real(p.id())) s = -1.e30;
+        }
+    }
+    ParallelDescriptor::ReduceLongSum(n);
+    ParallelDescriptor::ReduceRealSum(s);
+    return {n, s};
+}
+
+// Whether the cached near grids are the grids touching each local grid
+// grown by one cell, and the cached neighbor ranks are computed anew.
+bool cachesMatch (NearGridContainer const& pc)
+{
+    const BoxArray& ba = pc.ParticleBoxArray(0);
+    const DistributionMapping& dm = pc.ParticleDistributionMap(0);
+    std::map<int, Vector<int> > expected;
+    for (int gid = 0; gid < ba.size(); ++gid) {
+        if (dm[gid] != ParallelDescriptor::MyProc()) continue;
+        auto& v = expected[gid];
+        const Box halo = amrex::grow(ba[gid], 1);
+        for (int j = 0; j < ba.size(); ++j) {
+            if (j != gid && ba[j].intersects(halo)) v.push_back(j);
+        }
+    }
+    bool ok = (pc.nearGrids(0) == expected) && pc.allNoFiner(0);
+    for (int ngrow : {1, 2}) {
+        ok = ok && (pc.NeighborProcs(ngrow) == computeNeighborProcs(pc.GetParGDB(), ngrow));
+    }
+    ParallelDescriptor::ReduceBoolAnd(ok);
+    return ok;
+}
+
+void runSteps (NearGridContainer& pc, int nsteps, std::pair<Long,Real> const& c0,
+               std::string const& what)
+{
+    for (int step = 0; step < nsteps; ++step) {
+        // Alternate between the global and the local Redistribute
+        const int local = step % 2;
+        moveParticles(pc);
+        pc.Redistribute(0, -1, 0, local);
+    }
+    if (census(pc) != c0) {
+        amrex::Abort(what + ": particles lost");
+    }
+    if (!inWhereTile(pc)) {
+        amrex::Abort(what + ": a particle is not in the grid and tile of Where");
+    }
+    if (!cachesMatch(pc)) {
+        amrex::Abort(what + ": the caches do not match the grids");
+    }
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 8;
+        int nppc = 2;
+        int nsteps = 4;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+            pp.query("nsteps", nsteps);
+        }
+
+        RealBox real_box;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            real_box.setLo(idim, 0.0);
+            real_box.setHi(idim, 1.0);
+        }
+        const Box domain(IntVect(0), IntVect(n_cell-1));
+        Array<int,AMREX_SPACEDIM> is_per{AMREX_D_DECL(1,1,1)};
+        const Geometry geom(domain, real_box, CoordSys::cartesian, is_per);
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        const DistributionMapping dm(ba);
+
+        NearGridContainer pc(geom, dm, ba);
+        amrex::InitRandom(451 + ParallelDescriptor::MyProc());
+        initParticles(pc, nppc);
+        pc.Redistribute();
+        const auto c0 = census(pc);
+
+        amrex::Print() << "Moves across the grid faces\n";
+        runSteps(pc, nsteps, c0, "initial grids");
+
+        amrex::Print() << "New grids\n";
+        {
+            BoxArray ba2(domain);
+            ba2.maxSize(IntVect(AMREX_D_DECL(max_grid_size*2, max_grid_size, max_grid_size/2)));
+            pc.SetParticleBoxArray(0, ba2);
+            pc.SetParticleDistributionMap(0, DistributionMapping(ba2));
+            pc.Redistribute();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(inWhereTile(pc), "redistributed to the new grids");
+            runSteps(pc, nsteps, c0, "new grids");
+        }
+
+        amrex::Print() << "Same grids, new distribution\n";
+        {
+            const BoxArray ba2 = pc.ParticleBoxArray(0);
+            Vector<int> pmap = pc.ParticleDistributionMap(0).ProcessorMap();
+            const int nprocs = ParallelDescriptor::NProcs();
+            for (auto& p : pmap) p = (p + 1) % nprocs;
+            pc.SetParticleDistributionMap(0, DistributionMapping(pmap));
+            pc.Redistribute();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(inWhereTile(pc), "redistributed to the new owners");
+            runSteps(pc, nsteps, c0, "new distribution");
+        }
+    }
+    amrex::Finalize();
+}
@@ -23,6 +23,10 @@ void testNeighborParticles();
 
 void testNeighborList();
 
+void testVerletList();
+
+void testVerletListEmptyRank();
+
 int main (int argc, char* argv[])
 {
     amrex::Initialize(argc,argv);
@@ -33,6 +37,12 @@ int main (int argc, char* argv[])
     amrex::PrintToFile("neighbor_test") << "Running neighbor list test \n";
     testNeighborList();
 
+    amrex::PrintToFile("neighbor_test") << "Running Verlet list test \n";
+    testVerletList();
+
+    amrex::PrintToFile("neighbor_test") << "Running Verlet list test with empty ranks \n";
+    testVerletListEmptyRank();
+
     amrex::Finalize();
 }
 
@@ -191,3 +201,123 @@ void testNeighborList ()
                              {"dummy"}, geom, 0.0, 0);
     pc.WritePlotFile("NeighborParticles_plt00001", "neighbors");
 }
+
+void testVerletList ()
+{
+    BL_PROFILE("testVerletList");
+    TestParams params;
+    get_test_params(params, "nbor_list");
+
+    RealBox real_box;
+    for (int n = 0; n < BL_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, params.size[n]);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[BL_SPACEDIM];
+    for (int i = 0; i < BL_SPACEDIM; i++)
+        is_per[i] = params.is_periodic;
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    const int ncells = 1;
+    MDParticleContainer pc(geom, dm, ba, ncells);
+
+    int npc = params.num_ppc;
+    IntVect nppc = IntVect(AMREX_D_DECL(npc, npc, npc));
+
+    pc.InitParticles(nppc, 1.0, 0.0);
+    pc.setVerletSkin(0.5);
+    pc.updateNeighborList(CheckPair());
+
+    // Each move displaces the particles by 0.1*sqrt(3), so the list is
+    // rebuilt every other step.
+    for (int step = 0; step < 4; ++step)
+    {
+        pc.moveParticles(static_cast<amrex::ParticleReal> (0.1));
+        bool rebuilt = pc.updateNeighborList(CheckPair());
+        amrex::PrintToFile("neighbor_test") << "Step " << step << ": rebuilt = " << rebuilt
+                                            << ", min distance is " << pc.minAndMaxDistance()
+                                            << ", should be (1, 1) \n";
+    }
+
+    amrex::PrintToFile("neighbor_test") << "Number of list builds is " << pc.numNeighborListBuilds()
+                                        << ", should be 3 \n";
+    AMREX_ALWAYS_ASSERT(pc.numNeighborListBuilds() == 3);
+}
+
+void testVerletListEmptyRank ()
+{
+    BL_PROFILE("testVerletListEmptyRank");
+    TestParams params;
+    get_test_params(params, "nbor_list");
+
+    RealBox real_box;
+    for (int n = 0; n < BL_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, params.size[n]);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[BL_SPACEDIM];
+    for (int i = 0; i < BL_SPACEDIM; i++)
+        is_per[i] = params.is_periodic;
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+
+    // All the grids, and so all the particles, are on the last rank.  The
+    // other ranks, rank 0 first in the reductions, have no tiles but must
+    // make the same rebuild decisions.
+    Vector<int> pmap(ba.size(), ParallelDescriptor::NProcs()-1);
+    DistributionMapping dm(pmap);
+
+    const int ncells = 1;
+    MDParticleContainer pc(geom, dm, ba, ncells);
+
+    int npc = params.num_ppc;
+    IntVect nppc = IntVect(AMREX_D_DECL(npc, npc, npc));
+
+    pc.InitParticles(nppc, 1.0, 0.0);
+    pc.setVerletSkin(0.5);
+    pc.updateNeighborList(CheckPair());
+
+    for (int step = 0; step < 4; ++step)
+    {
+        pc.moveParticles(static_cast<amrex::ParticleReal> (0.1));
+
+        Real dmax = pc.maxDisplacementSinceBuild();
+        Real dmin = dmax;
+        ParallelAllReduce::Min(dmin, ParallelContext::CommunicatorSub());
+        ParallelAllReduce::Max(dmax, ParallelContext::CommunicatorSub());
+        AMREX_ALWAYS_ASSERT(dmax == dmax && dmin == dmax);
+
+        int rebuilt = pc.updateNeighborList(CheckPair());
+        int rebuilt_min = rebuilt;
+        int rebuilt_max = rebuilt;
+        ParallelAllReduce::Min(rebuilt_min, ParallelContext::CommunicatorSub());
+        ParallelAllReduce::Max(rebuilt_max, ParallelContext::CommunicatorSub());
+        amrex::PrintToFile("neighbor_test") << "Step " << step << ": displacement = " << dmax
+                                            << ", rebuilt = " << rebuilt << "\n";
+        AMREX_ALWAYS_ASSERT(rebuilt_min == rebuilt_max);
+    }
+
+    amrex::PrintToFile("neighbor_test") << "Number of list builds is " << pc.numNeighborListBuilds()
+                                        << ", should be 3 \n";
+    AMREX_ALWAYS_ASSERT(pc.numNeighborListBuilds() == 3);
+}
@@ -0,0 +1,174 @@
+// Checks the per-grid particle costs accumulated by the ParIter loops
+// (ParticleContainer::setParticleCostType).  With CostType::Count, each
+// loop over the particles that asks for it must add the number of particles
+// of every grid to its cost, whatever the tiling and threading of the loop,
+// while the other loops, including the ones of the library, add nothing.
+// The costs are reset by resetParticleCosts and when the grids change, and
+// addParticleCosts adds their total to a work estimate on any grids.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Particles.H>
+
+#include <cmath>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+
+using PC = ParticleContainer<1,0>;
+
+// Touches every particle, with tiling and OpenMP threads.
+void pushParticles (PC& pc)
+{
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (PC::ParIterType pti(pc, 0, true); pti.isValid(); ++pti)
+    {
+        auto& aos = pti.GetArrayOfStructs();
+        for (auto& p : aos) p.rdata(0) += Real(1.0);
+    }
+}
+
+Real sumParticles (PC const& pc, bool add_costs = true)
+{
+    Real r = 0.0;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel reduction(+:r) if (Gpu::notInLaunchRegion())
+#endif
+    for (PC::ParConstIterType pti(pc, 0, add_costs); pti.isValid(); ++pti)
+    {
+        for (auto const& p : pti.GetArrayOfStructs()) r += p.rdata(0);
+    }
+    return r;
+}
+
+// Whether the cost of every grid is factor times its number of particles.
+// The particles are counted from the tiles directly.
+bool costsMatch (PC& pc, Real factor)
+{
+    auto& costs = pc.ParticleCosts(0);
+    LayoutData<Long> np(costs.boxArray(), costs.DistributionMap());
+    for (MFIter mfi(np); mfi.isValid(); ++mfi) np[mfi] = 0;
+    for (auto const& kv : pc.GetParticles(0)) {
+        np[kv.first.first] += kv.second.numParticles();
+    }
+    bool ok = true;
+    for (MFIter mfi(costs); mfi.isValid(); ++mfi) {
+        ok = ok && costs[mfi] == factor*static_cast<Real>(np[mfi]);
+    }
+    ParallelDescriptor::ReduceBoolAnd(ok);
+    return ok;
+}
+
+Real sumCosts (PC& pc)
+{
+    auto const& costs = pc.ParticleCosts(0);
+    Real r = 0.0;
+    for (MFIter mfi(costs); mfi.isValid(); ++mfi) r += costs[mfi];
+    ParallelDescriptor::ReduceRealSum(r);
+    return r;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 32;
+        int max_grid_size = 8;
+        int nppc = 2;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+        }
+
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        const Box domain(IntVect(0), IntVect(n_cell-1));
+        Geometry geom(domain, rb, CoordSys::cartesian, {AMREX_D_DECL(1,1,1)});
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        PC pc(geom, dm, ba);
+        PC::ParticleInitData pdata = {{0.0}, {}, {}, {}};
+        pc.InitNRandomPerCell(nppc, pdata);
+        // Put more particles in some grids than in others.
+        pc.InitRandom(n_cell*n_cell, 451, pdata, false,
+                      RealBox({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(0.3,0.5,0.7)}));
+        const Real np_total = static_cast<Real>(pc.TotalNumberOfParticles());
+
+        amrex::Print() << "CostType::Count\n";
+        pc.setParticleCostType(PC::CostType::Count);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(sumCosts(pc) == 0.0, "zero after setParticleCostType");
+
+        pushParticles(pc);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(costsMatch(pc, 1.0),
+                                         "ParIter adds the particles of each grid");
+
+        Real s = sumParticles(pc);
+        ParallelDescriptor::ReduceRealSum(s);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(s == np_total, "the loops visit every particle");
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(costsMatch(pc, 2.0), "ParConstIter adds them too");
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(sumCosts(pc) == 2.0*np_total, "total cost");
+
+        sumParticles(pc, false);
+        pc.TotalNumberOfParticles();
+        pc.SortParticlesByCell();
+        pc.Redistribute();
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(costsMatch(pc, 2.0), "the other loops add nothing");
+
+        pc.resetParticleCosts();
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(sumCosts(pc) == 0.0, "zero after resetParticleCosts");
+
+        amrex::Print() << "addParticleCosts\n";
+        pushParticles(pc);
+        {
+            // On the particle grids, and on other grids
+            for (int mgs : {max_grid_size, max_grid_size*2}) {
+                BoxArray wba(domain);
+                wba.maxSize(mgs);
+                MultiFab wgt(wba, DistributionMapping(wba), 1, 0);
+                wgt.setVal(1.0);
+                pc.addParticleCosts(wgt, 0, 2.0, 3.0);
+                const Real expected = 2.0*static_cast<Real>(domain.numPts()) + 3.0*np_total;
+                if (!(std::abs(wgt.sum() - expected) <= Real(1.e-10)*expected)) {
+                    amrex::Abort("wrong mesh and particle work on grids of size "
+                                 + std::to_string(mgs));
+                }
+            }
+        }
+
+        amrex::Print() << "New grids\n";
+        {
+            BoxArray ba2(domain);
+            ba2.maxSize(max_grid_size*2);
+            pc.SetParticleBoxArray(0, ba2);
+            pc.SetParticleDistributionMap(0, DistributionMapping(ba2));
+            pc.Redistribute();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(sumCosts(pc) == 0.0, "zero on the new grids");
+            pushParticles(pc);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(costsMatch(pc, 1.0),
+                                             "ParIter adds the particles of each new grid");
+        }
+
+        amrex::Print() << "CostType::Timer\n";
+        {
+            pc.setParticleCostType(PC::CostType::Timer);
+            pushParticles(pc);
+            auto const& costs = pc.ParticleCosts(0);
+            bool nonneg = true;
+            for (MFIter mfi(costs); mfi.isValid(); ++mfi) nonneg = nonneg && costs[mfi] >= 0.0;
+            ParallelDescriptor::ReduceBoolAnd(nonneg);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(nonneg && sumCosts(pc) > 0.0, "positive times");
+        }
+    }
+    amrex::Finalize();
+}
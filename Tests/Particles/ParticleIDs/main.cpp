@@ -0,0 +1,178 @@
+// Checks that particle IDs are unique when they are handed out by
+// Particle::NextID from many OpenMP threads at once, mixed with bulk
+// reservations by Particle::NextIDs(n), across a reset of the counter, and
+// for the particles created by the InitRandom and InitNRandomPerCell
+// initializers of ParticleContainer on every rank.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_Particles.H>
+#ifdef AMREX_USE_OMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+using namespace amrex;
+
+namespace {
+
+using PType = Particle<1,0>;
+
+bool allUnique (Vector<Long> v)
+{
+    std::sort(v.begin(), v.end());
+    return std::adjacent_find(v.begin(), v.end()) == v.end();
+}
+
+// IDs handed out by NextID and NextIDs in a parallel region.  Every
+// nreserve-th call of a thread reserves nbulk IDs at once.
+Vector<Long> threadedIDs (int nthreads, int nper_thread, int nreserve, Long nbulk)
+{
+    Vector<Vector<Long> > ids(nthreads);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+    {
+#ifdef AMREX_USE_OMP
+        const int tid = omp_get_thread_num();
+#else
+        const int tid = 0;
+#endif
+        auto& v = ids[tid];
+        for (int i = 0; i < nper_thread; ++i) {
+            if (nreserve > 0 && i % nreserve == 0) {
+                const Long first = PType::NextIDs(nbulk);
+                for (Long n = 0; n < nbulk; ++n) v.push_back(first+n);
+            } else {
+                v.push_back(PType::NextID());
+            }
+        }
+    }
+    Vector<Long> r;
+    for (auto const& v : ids) r.insert(r.end(), v.begin(), v.end());
+    return r;
+}
+
+// The (cpu, id) pairs of all the particles of pc, on the I/O processor
+template <class PC>
+Vector<Long> gatherCpuIDs (PC& pc)
+{
+    Vector<Long> local;
+    for (int lev = 0; lev <= pc.finestLevel(); ++lev) {
+        for (typename PC::ParConstIterType pti(pc, lev); pti.isValid(); ++pti) {
+            for (auto const& p : pti.GetArrayOfStructs()) {
+                local.push_back((static_cast<Long>(p.cpu()) << 40) | static_cast<Long>(p.id()));
+            }
+        }
+    }
+
+    const int nprocs = ParallelDescriptor::NProcs();
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    const int n = static_cast<int>(local.size());
+    const std::vector<int> counts = ParallelDescriptor::Gather(n, ioproc);
+    // The counts are only gathered on the I/O processor
+    std::vector<int> disp(nprocs, 0);
+    Vector<Long> all;
+    if (ParallelDescriptor::IOProcessor()) {
+        for (int i = 1; i < nprocs; ++i) disp[i] = disp[i-1] + counts[i-1];
+        all.resize(disp[nprocs-1]+counts[nprocs-1]);
+    }
+    ParallelDescriptor::Gatherv(local.data(), n, all.data(), counts, disp, ioproc);
+    return all;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int nthreads = 4;
+        int nper_thread = 5000;
+        int n_cell = 16;
+        int max_grid_size = 8;
+        {
+            ParmParse pp;
+            pp.query("nthreads", nthreads);
+            pp.query("nper_thread", nper_thread);
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+        }
+#ifndef AMREX_USE_OMP
+        // threadedIDs runs its region once without OpenMP
+        nthreads = 1;
+#endif
+
+        amrex::Print() << "NextID outside a parallel region\n";
+        {
+            const Long a = PType::NextID();
+            const Long b = PType::NextID();
+            const Long c = PType::NextIDs(10);
+            const Long d = PType::NextID();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(b == a+1 && c == b+1 && d == c+10, "consecutive IDs");
+        }
+
+        amrex::Print() << "NextID on " << nthreads << " threads\n";
+        {
+            Vector<Long> ids = threadedIDs(nthreads, nper_thread, 0, 0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(static_cast<int>(ids.size()) == nthreads*nper_thread,
+                                             "number of IDs");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(allUnique(ids), "unique IDs");
+            const Long next = PType::NextID();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(next > *std::max_element(ids.begin(), ids.end()),
+                                             "the counter is past every ID handed out");
+        }
+
+        amrex::Print() << "NextID and NextIDs on " << nthreads << " threads\n";
+        {
+            Vector<Long> ids = threadedIDs(nthreads, nper_thread, 7, 100);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(allUnique(ids), "unique IDs");
+            const Long next = PType::NextID();
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(next > *std::max_element(ids.begin(), ids.end()),
+                                             "the counter is past every ID handed out");
+        }
+
+        amrex::Print() << "NextID after a reset of the counter\n";
+        {
+            // Leave partly used blocks on the threads, then reset.
+            Vector<Long> before = threadedIDs(nthreads, 10, 0, 0);
+            const Long reset = PType::NextID() + 1000000;
+            PType::NextID(reset);
+            Vector<Long> after = threadedIDs(nthreads, 10, 0, 0);
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(*std::min_element(after.begin(), after.end()) >= reset,
+                                             "IDs start from the new counter");
+            AMREX_ALWAYS_ASSERT_WITH_MESSAGE(allUnique(after), "unique IDs");
+        }
+
+        amrex::Print() << "Particle initializers\n";
+        {
+            RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+            const Box domain(IntVect(0), IntVect(n_cell-1));
+            Geometry geom(domain, rb, CoordSys::cartesian, {AMREX_D_DECL(1,1,1)});
+            BoxArray ba(domain);
+            ba.maxSize(max_grid_size);
+            DistributionMapping dm(ba);
+
+            using PC = ParticleContainer<1,0>;
+            PC pc(geom, dm, ba);
+            PC::ParticleInitData pdata = {{1.0}, {}, {}, {}};
+
+            const Long nrandom = 10000;
+            pc.InitRandom(nrandom, 451, pdata, false);
+            pc.InitNRandomPerCell(2, pdata);
+            pc.InitRandom(nrandom, 452, pdata, true);
+
+            const Long np = pc.TotalNumberOfParticles();
+            Vector<Long> ids = gatherCpuIDs(pc);
+            if (ParallelDescriptor::IOProcessor()) {
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(static_cast<Long>(ids.size()) == np,
+                                                 "all particles gathered");
+                AMREX_ALWAYS_ASSERT_WITH_MESSAGE(allUnique(ids), "unique (cpu, id) pairs");
+            }
+        }
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,470 @@
+// Benchmark of the particle push and charge deposition with the particle
+// attributes (velocity and weight) stored either in the particle struct or
+// in the struct-of-arrays, with the positions and ids in the particle
+// struct, and in a pure SoA container, which has no particle structs and
+// keeps the positions and ids in arrays too.  The kernels are written once
+// against ParticleTileData, and only the attribute accessor differs.  Each variant
+// is also run with the field gather, the push and the deposition fused in
+// one pass with GatherPushDeposit, and the fused runs must give the same
+// charge density, cell by cell, and the same particle positions and
+// velocities as the separate passes, in a field that varies in space.
+// After the last step the separate runs call Redistribute, and the fused
+// runs Redistribute with the leavers recorded by GatherPushDeposit, and
+// every particle must end up in the same tile.  That Redistribute must
+// still pass every particle to particlePostLocate.
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Particles.H>
+#include <AMReX_ParticleMesh.H>
+#include <AMReX_ParticleInterpolators.H>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+using namespace amrex;
+
+namespace {
+
+// What a run leaves behind: the charge density of the last step, and the
+// grid, tile, positions and velocities of the particles in the order of
+// their ids.
+struct Result
+{
+    MultiFab rho;
+    Vector<Real> particles;
+};
+
+constexpr int NAttribs = AMREX_SPACEDIM + 1;  // velocity, weight
+
+struct AoSLayout
+{
+    using PC = ParticleContainer<NAttribs, 0, 0, 0>;
+    static std::string name () { return "AoS attributes"; }
+
+    template <class PTD>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    static decltype(auto) attrib (PTD const& ptd, int comp, int i) noexcept
+    {
+        return ptd.m_aos[i].rdata(comp);
+    }
+};
+
+struct SoALayout
+{
+    using PC = ParticleContainer<0, 0, NAttribs, 0>;
+    static std::string name () { return "SoA attributes"; }
+
+    template <class PTD>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    static decltype(auto) attrib (PTD const& ptd, int comp, int i) noexcept
+    {
+        return ptd.m_rdata[comp][i];
+    }
+};
+
+struct PureSoALayout
+{
+    using PC = ParticleContainerPureSoA<NAttribs, 0>;
+    static std::string name () { return "pure SoA"; }
+
+    template <class PTD>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    static decltype(auto) attrib (PTD const& ptd, int comp, int i) noexcept
+    {
+        return ptd.m_rdata[comp][i];
+    }
+};
+
+template <class L>
+void initParticles (typename L::PC& pc, int nppc)
+{
+    using SuperParticleType = typename L::PC::SuperParticleType;
+    const auto plo = pc.Geom(0).ProbLoArray();
+    const auto dx = pc.Geom(0).CellSizeArray();
+
+    for (MFIter mfi = pc.MakeMFIter(0); mfi.isValid(); ++mfi)
+    {
+        const Box& tbx = mfi.tilebox();
+        auto& ptile = pc.DefineAndReturnParticleTile(0, mfi.index(), mfi.LocalTileIndex());
+        amrex::LoopOnCpu(tbx, [&] (int i, int j, int k)
+        {
+            const IntVect iv(AMREX_D_DECL(i,j,k));
+            for (int n = 0; n < nppc; ++n) {
+                SuperParticleType p;
+                p.id() = SuperParticleType::NextID();
+                p.cpu() = ParallelDescriptor::MyProc();
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    p.pos(idim) = plo[idim] + (iv[idim] + amrex::Random())*dx[idim];
+                    p.rdata(idim) = 2.0*amrex::Random() - 1.0;
+                }
+                p.rdata(AMREX_SPACEDIM) = 1.0;
+                ptile.push_back(p);
+            }
+        });
+    }
+}
+
+// A periodic field that varies in every direction and component, filled
+// in the ghost cells too.  Its magnitude is small enough that the
+// particles move less than a third of a cell in all.
+void initField (MultiFab& efield, Geometry const& geom)
+{
+    const auto plo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+    const Real twopi = Real(2.0)*Real(3.14159265358979323846264338327950288);
+    for (MFIter mfi(efield); mfi.isValid(); ++mfi)
+    {
+        auto const& e = efield.array(mfi);
+        amrex::ParallelFor(mfi.fabbox(), AMREX_SPACEDIM,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            const Real x = plo[0] + (i+Real(0.5))*dx[0];
+            const Real y = (AMREX_SPACEDIM > 1) ? plo[1] + (j+Real(0.5))*dx[1] : Real(0.0);
+            const Real z = (AMREX_SPACEDIM > 2) ? plo[2] + (k+Real(0.5))*dx[2] : Real(0.0);
+            e(i,j,k,n) = Real(0.25) * std::sin(twopi*(x + Real(n)/3))
+                                    * std::cos(twopi*(y - z));
+        });
+    }
+}
+
+template <class L>
+Vector<Real> particleData (typename L::PC& pc)
+{
+    using ParIter = typename L::PC::ParIterType;
+    Vector<std::pair<Long, Vector<Real> > > pdata;
+    for (ParIter pti(pc, 0); pti.isValid(); ++pti)
+    {
+        const auto ptd = pti.GetParticleTile().getConstParticleTileData();
+        for (int i = 0; i < pti.numParticles(); ++i) {
+            const auto p = ptd.getSuperParticle(i);
+            Vector<Real> v{Real(pti.index()), Real(pti.LocalTileIndex())};
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                v.push_back(p.pos(idim));
+                v.push_back(p.rdata(idim));
+            }
+            pdata.emplace_back(p.id(), std::move(v));
+        }
+    }
+    std::sort(pdata.begin(), pdata.end());
+    Vector<Real> r;
+    for (auto const& pd : pdata) r.insert(r.end(), pd.second.begin(), pd.second.end());
+    return r;
+}
+
+// The per-particle kernels, shared by the separate and the fused passes
+
+template <class L, class PTD>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+void gatherOne (PTD const& ptd, int i, Array4<Real const> const& e,
+                GpuArray<Real,AMREX_SPACEDIM> const& plo,
+                GpuArray<Real,AMREX_SPACEDIM> const& dxi, Real dt) noexcept
+{
+    // A copy of the particle for its position, which a pure SoA tile keeps
+    // in arrays
+    auto p = ptd.getParticle(i);
+    ParticleInterpolator::Linear interp(p, plo, dxi);
+    interp.MeshToParticle(p, e, 0, 0, AMREX_SPACEDIM,
+        [=] AMREX_GPU_DEVICE (Array4<Real const> const& a, int ii, int jj, int kk, int comp)
+        {
+            return a(ii,jj,kk,comp);
+        },
+        [=] AMREX_GPU_DEVICE (typename L::PC::ParticleType&, int comp, Real val)
+        {
+            L::attrib(ptd,comp,i) += dt*val;
+        });
+}
+
+template <class L, class PTD>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+void pushOne (PTD const& ptd, int i, Real dt) noexcept
+{
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        ptd.pos(idim,i) += dt*L::attrib(ptd,idim,i);
+    }
+}
+
+template <class L, class PTD>
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+void depositOne (PTD const& ptd, int i, Array4<Real> const& arr,
+                 GpuArray<Real,AMREX_SPACEDIM> const& plo,
+                 GpuArray<Real,AMREX_SPACEDIM> const& dxi) noexcept
+{
+    int l[3] = {0, 0, 0};
+    Real w[3][2] = {{1.0, 0.0}, {1.0, 0.0}, {1.0, 0.0}};
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        Real x = (ptd.pos(idim,i) - plo[idim])*dxi[idim] - Real(0.5);
+        l[idim] = static_cast<int>(amrex::Math::floor(x));
+        w[idim][1] = x - l[idim];
+        w[idim][0] = Real(1.0) - w[idim][1];
+    }
+    const Real q = L::attrib(ptd,AMREX_SPACEDIM,i);
+    for (int kk = 0; kk <= (AMREX_SPACEDIM > 2); ++kk) {
+    for (int jj = 0; jj <= (AMREX_SPACEDIM > 1); ++jj) {
+    for (int ii = 0; ii <= 1; ++ii) {
+        Gpu::Atomic::AddNoRet(&arr(l[0]+ii,l[1]+jj,l[2]+kk),
+                              q*w[0][ii]*w[1][jj]*w[2][kk]);
+    }}}
+}
+
+template <class L>
+void gather (typename L::PC& pc, MultiFab const& efield, Real dt)
+{
+    using PTD = typename L::PC::ParticleTileType::ParticleTileDataType;
+    amrex::MeshToParticle(pc, efield, 0,
+        [=] AMREX_GPU_DEVICE (PTD const& ptd, int i, Array4<Real const> const& e,
+                              GpuArray<Real,AMREX_SPACEDIM> const& plo,
+                              GpuArray<Real,AMREX_SPACEDIM> const& dxi) noexcept
+        {
+            gatherOne<L>(ptd, i, e, plo, dxi, dt);
+        });
+}
+
+template <class L>
+void push (typename L::PC& pc, Real dt)
+{
+    using ParIter = typename L::PC::ParIterType;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (ParIter pti(pc, 0); pti.isValid(); ++pti)
+    {
+        const int np = pti.numParticles();
+        const auto ptd = pti.GetParticleTile().getParticleTileData();
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (int i) noexcept
+        {
+            pushOne<L>(ptd, i, dt);
+        });
+    }
+}
+
+template <class L>
+void deposit (typename L::PC const& pc, MultiFab& rho)
+{
+    using PTD = typename L::PC::ParticleTileType::ConstParticleTileDataType;
+    amrex::ParticleToMesh(pc, rho, 0,
+        [=] AMREX_GPU_DEVICE (PTD const& ptd, int i, Array4<Real> const& arr,
+                              GpuArray<Real,AMREX_SPACEDIM> const& plo,
+                              GpuArray<Real,AMREX_SPACEDIM> const& dxi) noexcept
+        {
+            depositOne<L>(ptd, i, arr, plo, dxi);
+        });
+}
+
+template <class L>
+Long gatherPushDeposit (typename L::PC& pc, MultiFab const& efield, MultiFab& rho, Real dt,
+                        ParticleTileLeavers& leavers)
+{
+    using PTD = typename L::PC::ParticleTileType::ParticleTileDataType;
+    return amrex::GatherPushDeposit(pc, efield, rho, 0,
+        [=] AMREX_GPU_DEVICE (PTD const& ptd, int i, Array4<Real const> const& e,
+                              Array4<Real> const& arr,
+                              GpuArray<Real,AMREX_SPACEDIM> const& plo,
+                              GpuArray<Real,AMREX_SPACEDIM> const& dxi) noexcept
+        {
+            gatherOne<L>(ptd, i, e, plo, dxi, dt);
+            pushOne<L>(ptd, i, dt);
+            depositOne<L>(ptd, i, arr, plo, dxi);
+        }, true, &leavers);
+}
+
+template <class L>
+Result runFused (Geometry const& geom, BoxArray const& ba, DistributionMapping const& dm,
+               int nppc, int nsteps)
+{
+    typename L::PC pc(geom, dm, ba);
+    initParticles<L>(pc, nppc);
+    const Long np = pc.TotalNumberOfParticles();
+
+    MultiFab efield(ba, dm, AMREX_SPACEDIM, 2);
+    initField(efield, geom);
+    MultiFab rho(ba, dm, 1, 2);
+    const Real dt = Real(0.25)*geom.CellSize(0)/nsteps;
+
+    Long num_left = 0;
+    ParticleTileLeavers leavers;
+    Real t_fused = 0.0;
+    for (int step = 0; step < nsteps; ++step) {
+        Real t0 = amrex::second();
+        num_left = gatherPushDeposit<L>(pc, efield, rho, dt, leavers);
+        Gpu::synchronize();
+        t_fused += amrex::second() - t0;
+    }
+    ParallelDescriptor::ReduceRealMax(t_fused);
+
+    const Real mp = Real(np)*nsteps*Real(1.e-6);
+    amrex::Print() << "  " << L::name() << ", fused: " << mp/t_fused << " Mparticles/s, "
+                   << num_left << " particles left their tile\n";
+
+    pc.Redistribute(leavers);
+    AMREX_ALWAYS_ASSERT(pc.TotalNumberOfParticles() == np);
+
+    return Result{std::move(rho), particleData<L>(pc)};
+}
+
+template <class L>
+Result run (Geometry const& geom, BoxArray const& ba, DistributionMapping const& dm,
+          int nppc, int nsteps)
+{
+    typename L::PC pc(geom, dm, ba);
+    initParticles<L>(pc, nppc);
+    const Long np = pc.TotalNumberOfParticles();
+
+    // Two ghost cells, and a total displacement under a third of a cell,
+    // so that the particles need not be redistributed between the steps.
+    MultiFab efield(ba, dm, AMREX_SPACEDIM, 2);
+    initField(efield, geom);
+    MultiFab rho(ba, dm, 1, 2);
+    const Real dt = Real(0.25)*geom.CellSize(0)/nsteps;
+
+    Real t_gather = 0.0;
+    Real t_push = 0.0;
+    Real t_deposit = 0.0;
+    for (int step = 0; step < nsteps; ++step) {
+        Real t0 = amrex::second();
+        gather<L>(pc, efield, dt);
+        Gpu::synchronize();
+        Real t1 = amrex::second();
+        push<L>(pc, dt);
+        Gpu::synchronize();
+        Real t2 = amrex::second();
+        deposit<L>(pc, rho);
+        Gpu::synchronize();
+        Real t3 = amrex::second();
+        t_gather += t1-t0;
+        t_push += t2-t1;
+        t_deposit += t3-t2;
+    }
+    ParallelDescriptor::ReduceRealMax(t_gather);
+    ParallelDescriptor::ReduceRealMax(t_push);
+    ParallelDescriptor::ReduceRealMax(t_deposit);
+
+    const Real mp = Real(np)*nsteps*Real(1.e-6);
+    amrex::Print() << "  " << L::name() << ": gather " << mp/t_gather << ", push "
+                   << mp/t_push << ", deposit " << mp/t_deposit << ", all "
+                   << mp/(t_gather+t_push+t_deposit) << " Mparticles/s\n";
+
+    pc.Redistribute();
+    AMREX_ALWAYS_ASSERT(pc.TotalNumberOfParticles() == np);
+
+    return Result{std::move(rho), particleData<L>(pc)};
+}
+
+// A container that counts the particles given to particlePostLocate
+struct PostLocatePC
+    : public AoSLayout::PC
+{
+    using AoSLayout::PC::PC;
+
+    Long num_post_located = 0;
+
+private:
+    void particlePostLocate (ParticleType&, const ParticleLocData&, const int) override
+    {
+#ifdef AMREX_USE_OMP
+#pragma omp atomic
+#endif
+        ++num_post_located;
+    }
+};
+
+// Redistribute with the leavers of GatherPushDeposit must still pass every
+// particle, including the ones known to stay, to particlePostLocate.
+void checkPostLocate (Geometry const& geom, BoxArray const& ba, DistributionMapping const& dm,
+                      int nppc)
+{
+    PostLocatePC pc(geom, dm, ba);
+    initParticles<AoSLayout>(pc, nppc);
+    const Long np = pc.TotalNumberOfParticles(true, true);
+
+    MultiFab efield(ba, dm, AMREX_SPACEDIM, 2);
+    initField(efield, geom);
+    MultiFab rho(ba, dm, 1, 2);
+    ParticleTileLeavers leavers;
+    gatherPushDeposit<AoSLayout>(pc, efield, rho, Real(0.25)*geom.CellSize(0), leavers);
+
+    pc.Redistribute(leavers);
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(pc.num_post_located == np,
+                                     "Redistribute skipped particlePostLocate for some particles");
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc, argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 32;
+        int nppc = 8;
+        int nsteps = 10;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("nppc", nppc);
+            pp.query("nsteps", nsteps);
+        }
+
+        RealBox real_box;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            real_box.setLo(idim, 0.0);
+            real_box.setHi(idim, 1.0);
+        }
+        const Box domain(IntVect(0), IntVect(n_cell-1));
+        Array<int,AMREX_SPACEDIM> is_per{AMREX_D_DECL(1,1,1)};
+        Geometry geom(domain, real_box, CoordSys::cartesian, is_per);
+        BoxArray ba(domain);
+        ba.maxSize(max_grid_size);
+        DistributionMapping dm(ba);
+
+        amrex::Print() << "Particle attributes in AoS, SoA and pure SoA with " << nppc
+                       << " particles per cell on " << domain << ", " << nsteps << " steps\n";
+
+        amrex::InitRandom(451);
+        const Result aos = run<AoSLayout>(geom, ba, dm, nppc, nsteps);
+        amrex::InitRandom(451);
+        const Result soa = run<SoALayout>(geom, ba, dm, nppc, nsteps);
+        amrex::InitRandom(451);
+        const Result pure = run<PureSoALayout>(geom, ba, dm, nppc, nsteps);
+        amrex::InitRandom(451);
+        const Result aos_fused = runFused<AoSLayout>(geom, ba, dm, nppc, nsteps);
+        amrex::InitRandom(451);
+        const Result soa_fused = runFused<SoALayout>(geom, ba, dm, nppc, nsteps);
+        amrex::InitRandom(451);
+        const Result pure_fused = runFused<PureSoALayout>(geom, ba, dm, nppc, nsteps);
+
+        checkPostLocate(geom, ba, dm, nppc);
+
+        // All the runs move and deposit the same particles.  The order of
+        // the deposits into a cell may differ, the particle updates may not.
+        const Real rho_max = aos.rho.norm0();
+        amrex::Print() << "  total charge: " << aos.rho.sum() << " " << soa.rho.sum() << " "
+                       << pure.rho.sum() << " " << aos_fused.rho.sum() << " "
+                       << soa_fused.rho.sum() << " " << pure_fused.rho.sum() << "\n";
+        bool ok = rho_max > Real(0.0);
+        for (Result const* r : {&soa, &pure, &aos_fused, &soa_fused, &pure_fused})
+        {
+            MultiFab d(ba, dm, 1, 0);
+            MultiFab::Copy(d, r->rho, 0, 0, 1, 0);
+            MultiFab::Subtract(d, aos.rho, 0, 0, 1, 0);
+            ok = ok && d.norm0() <= Real(1.e-12)*rho_max;
+
+            bool same_particles = r->particles.size() == aos.particles.size();
+            for (Long i = 0; same_particles && i < aos.particles.size(); ++i) {
+                same_particles = std::abs(r->particles[i] - aos.particles[i])
+                    <= Real(1.e-14)*(Real(1.0) + std::abs(aos.particles[i]));
+            }
+            ParallelDescriptor::ReduceBoolAnd(same_particles);
+            ok = ok && same_particles;
+        }
+        if (!ok) {
+            amrex::Abort("ParticleLayout: the runs give different results");
+        }
+    }
+    amrex::Finalize();
+}
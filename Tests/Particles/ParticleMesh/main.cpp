@@ -10,6 +10,94 @@
 
 using namespace amrex;
 
+// The mass of the particles deposited with cloud-in-cell into a local fab
+// per tile, which is then added to the grid's fab, as ParticleToMesh and
+// AssignCellDensitySingleLevel did before the tiles were colored.
+template <class PC>
+void localFabDeposit (PC const& pc, MultiFab& rho)
+{
+  const auto plo = pc.Geom(0).ProbLoArray();
+  const auto dxi = pc.Geom(0).InvCellSizeArray();
+  rho.setVal(0.0);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  {
+    FArrayBox local_rho;
+    for (typename PC::ParConstIterType pti(pc, 0); pti.isValid(); ++pti) {
+      Box tile_box = pti.tilebox();
+      tile_box.grow(rho.nGrow());
+      local_rho.resize(tile_box, 1);
+      local_rho.template setVal<RunOn::Host>(0.0);
+      auto const& arr = local_rho.array();
+      auto const& particles = pti.GetArrayOfStructs();
+      for (int i = 0; i < pti.numParticles(); ++i) {
+        amrex_deposit_cic(particles[i], 1, arr, plo, dxi);
+      }
+      rho[pti].template atomicAdd<RunOn::Host>(local_rho, tile_box, tile_box, 0, 0, 1);
+    }
+  }
+  rho.SumBoundary(pc.Geom(0).periodicity());
+}
+
+// Checks that the deposition of ParticleToMesh and of
+// AssignCellDensitySingleLevel matches the local fab one cell by cell.
+// With tiling, these deposit the tiles directly into the grids' fabs,
+// one color of tiles at a time.
+template <class PC>
+void checkDeposition (PC const& pc, BoxArray const& ba, DistributionMapping const& dmap,
+                      bool verbose)
+{
+  const Geometry& geom = pc.Geom(0);
+  const auto plo = geom.ProbLoArray();
+  const auto dxi = geom.InvCellSizeArray();
+
+  bool colored = false;
+  if (pc.do_tiling) {
+    colored = true;
+    for (typename PC::ParConstIterType pti(pc, 0); pti.isValid(); ++pti) {
+      colored = colored && particle_detail::depositColor(pti.validbox(), pti.LocalTileIndex(),
+                                                         pc.do_tiling, pc.tile_size,
+                                                         IntVect(1)) >= 0;
+    }
+    ParallelDescriptor::ReduceBoolAnd(colored);
+    if (!colored) amrex::Abort("ParticleMesh: the particle tiles are too small to be colored");
+  }
+  if (verbose) {
+    amrex::Print() << "Deposition " << (colored ? "by color of tiles" : "without coloring")
+                   << " against local fabs\n";
+  }
+
+  MultiFab rho_ref(ba, dmap, 1, 1);
+  localFabDeposit(pc, rho_ref);
+  const Real rho_max = rho_ref.norm0();
+
+  MultiFab rho(ba, dmap, 1, 1);
+  amrex::ParticleToMesh(pc, rho, 0,
+      [=] AMREX_GPU_DEVICE (const typename PC::ParticleType& p,
+                            amrex::Array4<amrex::Real> const& arr)
+      {
+          amrex_deposit_cic(p, 1, arr, plo, dxi);
+      });
+  MultiFab::Subtract(rho, rho_ref, 0, 0, 1, 0);
+  const Real err_p2m = rho.norm0();
+
+  const Real* dx = geom.CellSize();
+  const Real vol = AMREX_D_TERM(dx[0], *dx[1], *dx[2]);
+  pc.AssignCellDensitySingleLevel(0, rho, 0, 1, 0);
+  rho.mult(vol, 0, 1, 0);
+  MultiFab::Subtract(rho, rho_ref, 0, 0, 1, 0);
+  const Real err_acd = rho.norm0();
+
+  if (verbose) {
+    amrex::Print() << "  ParticleToMesh max difference: " << err_p2m << "\n"
+                   << "  AssignCellDensitySingleLevel max difference: " << err_acd << "\n";
+  }
+  if (!(rho_max > 0.0) || err_p2m > 1.e-12*rho_max || err_acd > 1.e-12*rho_max) {
+    amrex::Abort("ParticleMesh: the deposition differs from the local fab one");
+  }
+}
+
 struct TestParams {
   int nx;
   int ny;
@@ -67,6 +155,8 @@ void testParticleMesh (TestParams& parms)
   MyParticleContainer::ParticleInitData pdata = {{mass, AMREX_D_DECL(1.0, 2.0, 3.0), AMREX_D_DECL(0.0, 0.0, 0.0)}, {},{},{}};
   myPC.InitRandom(num_particles, iseed, pdata, serialize);
 
+  checkDeposition(myPC, ba, dmap, parms.verbose);
+
   int nc = 1 + AMREX_SPACEDIM;
   const auto plo = geom.ProbLoArray();
   const auto dxi = geom.InvCellSizeArray();
@@ -3,6 +3,11 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_Particles.H>
 
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
 using namespace amrex;
 
 static constexpr int NSR = 6;
@@ -15,6 +20,10 @@ int num_runtime_int = 0;
 
 bool remove_negative = true;
 
+// Only put particles in the upper half in x of every grid, so that some
+// tiles start empty.
+bool half_filled = false;
+
 void get_position_unit_cell(Real* r, const IntVect& nppc, int i_part)
 {
     int nx = nppc[0];
@@ -93,6 +102,8 @@ public:
         for(MFIter mfi = MakeMFIter(lev); mfi.isValid(); ++mfi)
         {
             const Box& tile_box  = mfi.tilebox();
+            const Box& grid_box  = mfi.validbox();
+            const int half = grid_box.smallEnd(0) + grid_box.length(0)/2;
 
             Gpu::HostVector<ParticleType> host_particles;
             std::array<Gpu::HostVector<ParticleReal>, NAR> host_real;
@@ -103,6 +114,7 @@ public:
 
             for (IntVect iv = tile_box.smallEnd(); iv <= tile_box.bigEnd(); tile_box.next(iv))
             {
+                if (half_filled && iv[0] < half) continue;
                 for (int i_part=0; i_part<num_ppc;i_part++) {
                     Real r[3];
                     get_position_unit_cell(r, a_num_particles_per_cell, i_part);
@@ -194,8 +206,9 @@ public:
             {
                 int gid = mfi.index();
                 int tid = mfi.LocalTileIndex();
-                auto& ptile = plev[std::make_pair(gid, tid)];
-                auto& aos   = ptile.GetArrayOfStructs();
+                const auto ptile_it = plev.find(std::make_pair(gid, tid));
+                if (ptile_it == plev.end()) continue;
+                auto& aos   = ptile_it->second.GetArrayOfStructs();
                 ParticleType* pstruct = &(aos[0]);
                 const size_t np = aos.numParticles();
 
@@ -244,8 +257,9 @@ public:
             {
                 int gid = mfi.index();
                 int tid = mfi.LocalTileIndex();
-                auto& ptile = plev[std::make_pair(gid, tid)];
-                auto& aos   = ptile.GetArrayOfStructs();
+                const auto ptile_it = plev.find(std::make_pair(gid, tid));
+                if (ptile_it == plev.end()) continue;
+                auto& aos   = ptile_it->second.GetArrayOfStructs();
                 ParticleType* pstruct = &(aos[0]);
                 const size_t np = aos.numParticles();
                 amrex::ParallelFor( np, [=] AMREX_GPU_DEVICE (int i) noexcept
@@ -275,7 +289,9 @@ public:
             {
                 int gid = mfi.index();
                 int tid = mfi.LocalTileIndex();
-                auto& ptile = plev.at(std::make_pair(gid, tid));
+                const auto ptile_it = plev.find(std::make_pair(gid, tid));
+                if (ptile_it == plev.end()) continue;
+                auto& ptile = ptile_it->second;
                 const auto ptd = ptile.getConstParticleTileData();
                 const size_t np = ptile.numParticles();
 
@@ -309,6 +325,78 @@ public:
             }
         }
     }
+
+    // A host copy of the particle structs of every tile, in storage order
+    std::map<std::tuple<int,int,int>, Gpu::HostVector<ParticleType> > hostParticles () const
+    {
+        std::map<std::tuple<int,int,int>, Gpu::HostVector<ParticleType> > r;
+        for (int lev = 0; lev <= finestLevel(); ++lev)
+        {
+            for (auto const& kv : GetParticles(lev))
+            {
+                const auto& aos = kv.second.GetArrayOfStructs();
+                auto& h = r[std::make_tuple(lev, kv.first.first, kv.first.second)];
+                h.resize(aos.numParticles());
+                Gpu::copy(Gpu::deviceToHost, aos.begin(), aos.begin() + aos.numParticles(),
+                          h.begin());
+            }
+        }
+        return r;
+    }
+
+    // Sort along the Morton curve, starting from the cell order.  Every tile
+    // must keep its particles, with their data, and be in Morton order.
+    void checkMortonSort ()
+    {
+        BL_PROFILE("TestParticleContainer::checkMortonSort");
+
+        // The row-major cell order is not the Morton order
+        SortParticlesByCell();
+        auto before = hostParticles();
+        SortParticlesByMorton();
+        auto after = hostParticles();
+
+        AMREX_ALWAYS_ASSERT(before.size() == after.size());
+        bool reordered = false;
+        for (auto& kv : after)
+        {
+            const int lev = std::get<0>(kv.first);
+            const auto& p_after = kv.second;
+            auto& p_before = before[kv.first];
+            AMREX_ALWAYS_ASSERT(p_before.size() == p_after.size());
+
+            std::vector<Long> ids_before, ids_after;
+            for (auto const& p : p_before) ids_before.push_back(p.id());
+            for (auto const& p : p_after) ids_after.push_back(p.id());
+            std::sort(ids_before.begin(), ids_before.end());
+            std::sort(ids_after.begin(), ids_after.end());
+            AMREX_ALWAYS_ASSERT(ids_before == ids_after);
+
+            const int gid = std::get<1>(kv.first);
+            const int tid = std::get<2>(kv.first);
+            const Box tbx = getTileBox(lev, gid, tid);
+            GetParticleMortonKey get_key(Geom(lev).ProbLoArray(), Geom(lev).InvCellSizeArray(),
+                                         Geom(lev).Domain(), tbx);
+            for (int i = 1; i < static_cast<int>(p_after.size()); ++i) {
+                AMREX_ALWAYS_ASSERT(get_key(p_after[i-1]) <= get_key(p_after[i]));
+                reordered = reordered || get_key(p_before[i-1]) > get_key(p_before[i]);
+            }
+        }
+        ParallelDescriptor::ReduceBoolOr(reordered);
+        AMREX_ALWAYS_ASSERT(reordered);
+
+        // The struct-of-arrays data still belong to the ids
+        checkAnswer();
+    }
+
+    Box getTileBox (int lev, int gid, int tid) const
+    {
+        for (MFIter mfi = MakeMFIter(lev); mfi.isValid(); ++mfi) {
+            if (mfi.index() == gid && mfi.LocalTileIndex() == tid) return mfi.tilebox();
+        }
+        amrex::Abort("getTileBox: no such tile");
+        return Box();
+    }
 };
 
 struct TestParams
@@ -323,6 +411,7 @@ struct TestParams
     int nlevs;
     int do_regrid;
     int sort;
+    int morton_sort;
 };
 
 void testRedistribute();
@@ -352,9 +441,14 @@ void get_test_params(TestParams& params, const std::string& prefix)
     pp.query("num_runtime_real", num_runtime_real);
     pp.query("num_runtime_int", num_runtime_int);
     pp.query("remove_negative", remove_negative);
+    pp.query("half_filled", half_filled);
 
     params.sort = 0;
     pp.query("sort", params.sort);
+
+    params.morton_sort = 0;
+    pp.query("morton_sort", params.morton_sort);
+
 }
 
 void testRedistribute ()
@@ -432,6 +526,9 @@ void testRedistribute ()
         pc.checkAnswer();
     }
 
+    if (params.morton_sort) pc.checkMortonSort();
+
+
     if (params.do_regrid)
     {
         const int NProcs = ParallelDescriptor::NProcs();
@@ -0,0 +1,312 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Src/Amr/CMakeLists.txt"
+  "/root/repo/Src/AmrCore/CMakeLists.txt"
+  "/root/repo/Src/Base/CMakeLists.txt"
+  "/root/repo/Src/Boundary/CMakeLists.txt"
+  "/root/repo/Src/CMakeLists.txt"
+  "/root/repo/Src/LinearSolvers/CMakeLists.txt"
+  "/root/repo/Src/Particle/CMakeLists.txt"
+  "/root/repo/Tests/Amr/Advection_AmrCore/CMakeLists.txt"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/CMakeLists.txt"
+  "/root/repo/Tests/Amr/FillPatchCache/CMakeLists.txt"
+  "/root/repo/Tests/Amr/FillPatchPlan/CMakeLists.txt"
+  "/root/repo/Tests/Amr/FillPatchThroughput/CMakeLists.txt"
+  "/root/repo/Tests/Amr/FluxRegister/CMakeLists.txt"
+  "/root/repo/Tests/Amr/RegridKeepOwners/CMakeLists.txt"
+  "/root/repo/Tests/Amr/RegridMetrics/CMakeLists.txt"
+  "/root/repo/Tests/Amr/TagBox/CMakeLists.txt"
+  "/root/repo/Tests/AsyncOut/multifab/CMakeLists.txt"
+  "/root/repo/Tests/AverageDown/CMakeLists.txt"
+  "/root/repo/Tests/CLZ/CMakeLists.txt"
+  "/root/repo/Tests/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/ABecLaplacian_C/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/ABecLaplacian_F/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/AutoTune/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/CoeffUpdate/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/FusedCycle/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/GSRB/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/NodalPoisson/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/Nodal_Projection_EB/CMakeLists.txt"
+  "/root/repo/Tests/LinearSolvers/NodeTensorLap/CMakeLists.txt"
+  "/root/repo/Tests/MultiBlock/Advection/CMakeLists.txt"
+  "/root/repo/Tests/MultiBlock/IndexType/CMakeLists.txt"
+  "/root/repo/Tests/Parser/CMakeLists.txt"
+  "/root/repo/Tests/Particles/AssignDensity/CMakeLists.txt"
+  "/root/repo/Tests/Particles/AssignMultiLevelDensity/CMakeLists.txt"
+  "/root/repo/Tests/Particles/AsyncIO/CMakeLists.txt"
+  "/root/repo/Tests/Particles/DenseBins/CMakeLists.txt"
+  "/root/repo/Tests/Particles/GhostsAndVirtuals/CMakeLists.txt"
+  "/root/repo/Tests/Particles/InitFromAscii/CMakeLists.txt"
+  "/root/repo/Tests/Particles/Intersection/CMakeLists.txt"
+  "/root/repo/Tests/Particles/NearGrid/CMakeLists.txt"
+  "/root/repo/Tests/Particles/NeighborParticles/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParallelContext/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleArray/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleCosts/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleIDs/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleIterator/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleLayout/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleMesh/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleMeshMultiLevel/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleReduce/CMakeLists.txt"
+  "/root/repo/Tests/Particles/ParticleTransformations/CMakeLists.txt"
+  "/root/repo/Tests/Particles/Redistribute/CMakeLists.txt"
+  "/root/repo/Tests/Particles/SparseBins/CMakeLists.txt"
+  "/root/repo/Tests/Particles/TypeDescriptor/CMakeLists.txt"
+  "/root/repo/Tools/CMake/AMReXConfig.cmake.in"
+  "/root/repo/Tools/CMake/AMReXFlagsTargets.cmake"
+  "/root/repo/Tools/CMake/AMReXGenerateConfigHeader.cmake"
+  "/root/repo/Tools/CMake/AMReXGenexHelpers.cmake"
+  "/root/repo/Tools/CMake/AMReXInstallHelpers.cmake"
+  "/root/repo/Tools/CMake/AMReXOptions.cmake"
+  "/root/repo/Tools/CMake/AMReXParallelBackends.cmake"
+  "/root/repo/Tools/CMake/AMReXSetDefines.cmake"
+  "/root/repo/Tools/CMake/AMReXTargetHelpers.cmake"
+  "/root/repo/Tools/CMake/AMReXThirdPartyLibraries.cmake"
+  "/root/repo/Tools/CMake/AMReXUtils.cmake"
+  "/root/repo/Tools/CMake/AMReX_Config.H.in"
+  "/root/repo/Tools/CMake/AMReX_Config.cmake"
+  "/root/repo/Tools/CMake/AMReX_ThirdPartyProfilers.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "lib/cmake/AMReX/AMReXConfig.cmake"
+  "lib/cmake/AMReX/AMReXConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "AMReX_Config.H"
+  "Src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Src/Base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Src/Boundary/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Src/AmrCore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Src/Amr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Src/LinearSolvers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Src/Particle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/AsyncOut/multifab/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/MultiBlock/Advection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/MultiBlock/IndexType/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/Advection_AmrCore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/Advection_AmrLevel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/FillPatchCache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/FillPatchPlan/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/FillPatchThroughput/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/FluxRegister/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/RegridKeepOwners/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/RegridMetrics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Amr/TagBox/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/CLZ/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/AverageDown/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/AssignDensity/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/AssignMultiLevelDensity/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/AsyncIO/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/DenseBins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/GhostsAndVirtuals/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/InitFromAscii/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/Intersection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/NearGrid/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/NeighborParticles/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParallelContext/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleArray/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleCosts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleIDs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleIterator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleLayout/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleMesh/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleMeshMultiLevel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleReduce/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/ParticleTransformations/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/Redistribute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/SparseBins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/Particles/TypeDescriptor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/ABecLaplacian_F/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/AutoTune/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/CoeffUpdate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/FusedCycle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/GSRB/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/NodalPoisson/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/Nodal_Projection_EB/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Tests/LinearSolvers/NodeTensorLap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/test_install.dir/DependInfo.cmake"
+  "Src/CMakeFiles/amrex.dir/DependInfo.cmake"
+  "Tests/AsyncOut/multifab/CMakeFiles/Test_AsyncOut_multifab.dir/DependInfo.cmake"
+  "Tests/MultiBlock/Advection/CMakeFiles/Test_MultiBlock_Advection.dir/DependInfo.cmake"
+  "Tests/MultiBlock/IndexType/CMakeFiles/Test_MultiBlock_IndexType.dir/DependInfo.cmake"
+  "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/DependInfo.cmake"
+  "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_SV.dir/DependInfo.cmake"
+  "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/DependInfo.cmake"
+  "Tests/Amr/FillPatchCache/CMakeFiles/Test_Amr_FillPatchCache.dir/DependInfo.cmake"
+  "Tests/Amr/FillPatchPlan/CMakeFiles/Test_Amr_FillPatchPlan.dir/DependInfo.cmake"
+  "Tests/Amr/FillPatchThroughput/CMakeFiles/Test_Amr_FillPatchThroughput.dir/DependInfo.cmake"
+  "Tests/Amr/FluxRegister/CMakeFiles/Test_Amr_FluxRegister.dir/DependInfo.cmake"
+  "Tests/Amr/RegridKeepOwners/CMakeFiles/Test_Amr_RegridKeepOwners.dir/DependInfo.cmake"
+  "Tests/Amr/RegridMetrics/CMakeFiles/Test_Amr_RegridMetrics.dir/DependInfo.cmake"
+  "Tests/Amr/TagBox/CMakeFiles/Test_Amr_TagBox.dir/DependInfo.cmake"
+  "Tests/CLZ/CMakeFiles/Test_CLZ.dir/DependInfo.cmake"
+  "Tests/Parser/CMakeFiles/Test_Parser.dir/DependInfo.cmake"
+  "Tests/AverageDown/CMakeFiles/Test_AverageDown.dir/DependInfo.cmake"
+  "Tests/Particles/AssignDensity/CMakeFiles/Test_Particles_AssignDensity.dir/DependInfo.cmake"
+  "Tests/Particles/AssignMultiLevelDensity/CMakeFiles/Test_Particles_AssignMultiLevelDensity.dir/DependInfo.cmake"
+  "Tests/Particles/AsyncIO/CMakeFiles/Test_Particles_AsyncIO.dir/DependInfo.cmake"
+  "Tests/Particles/DenseBins/CMakeFiles/Test_Particles_DenseBins.dir/DependInfo.cmake"
+  "Tests/Particles/GhostsAndVirtuals/CMakeFiles/Test_Particles_GhostsAndVirtuals.dir/DependInfo.cmake"
+  "Tests/Particles/InitFromAscii/CMakeFiles/Test_Particles_InitFromAscii.dir/DependInfo.cmake"
+  "Tests/Particles/Intersection/CMakeFiles/Test_Particles_Intersection.dir/DependInfo.cmake"
+  "Tests/Particles/NearGrid/CMakeFiles/Test_Particles_NearGrid.dir/DependInfo.cmake"
+  "Tests/Particles/NeighborParticles/CMakeFiles/Test_Particles_NeighborParticles.dir/DependInfo.cmake"
+  "Tests/Particles/ParallelContext/CMakeFiles/Test_Particles_ParallelContext.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleArray/CMakeFiles/Test_Particles_ParticleArray.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleCosts/CMakeFiles/Test_Particles_ParticleCosts.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleIDs/CMakeFiles/Test_Particles_ParticleIDs.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleIterator/CMakeFiles/Test_Particles_ParticleIterator.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleLayout/CMakeFiles/Test_Particles_ParticleLayout.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleMesh/CMakeFiles/Test_Particles_ParticleMesh.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleMeshMultiLevel/CMakeFiles/Test_Particles_ParticleMeshMultiLevel.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleReduce/CMakeFiles/Test_Particles_ParticleReduce.dir/DependInfo.cmake"
+  "Tests/Particles/ParticleTransformations/CMakeFiles/Test_Particles_ParticleTransformations.dir/DependInfo.cmake"
+  "Tests/Particles/Redistribute/CMakeFiles/Test_Particles_Redistribute.dir/DependInfo.cmake"
+  "Tests/Particles/SparseBins/CMakeFiles/Test_Particles_SparseBins.dir/DependInfo.cmake"
+  "Tests/Particles/TypeDescriptor/CMakeFiles/Test_Particles_TypeDescriptor.dir/DependInfo.cmake"
+  "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/DependInfo.cmake"
+  "Tests/LinearSolvers/AutoTune/CMakeFiles/Test_LinearSolvers_AutoTune.dir/DependInfo.cmake"
+  "Tests/LinearSolvers/CoeffUpdate/CMakeFiles/Test_LinearSolvers_CoeffUpdate.dir/DependInfo.cmake"
+  "Tests/LinearSolvers/FusedCycle/CMakeFiles/Test_LinearSolvers_FusedCycle.dir/DependInfo.cmake"
+  "Tests/LinearSolvers/GSRB/CMakeFiles/Test_LinearSolvers_GSRB.dir/DependInfo.cmake"
+  "Tests/LinearSolvers/NodalPoisson/CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/DependInfo.cmake"
+  "Tests/LinearSolvers/NodeTensorLap/CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/Amr/Advection_AmrCore/Source/AdvancePhiAllLevels.cpp" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAllLevels.cpp.o" "gcc" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAllLevels.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrCore/Source/AdvancePhiAtLevel.cpp" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAtLevel.cpp.o" "gcc" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAtLevel.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrCore/Source/AmrCoreAdv.cpp" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AmrCoreAdv.cpp.o" "gcc" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AmrCoreAdv.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrCore/Source/DefineVelocity.cpp" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/DefineVelocity.cpp.o" "gcc" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/DefineVelocity.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrCore/Source/main.cpp" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/main.cpp.o" "gcc" "Tests/Amr/Advection_AmrCore/CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mpi/Src/CMakeFiles/amrex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
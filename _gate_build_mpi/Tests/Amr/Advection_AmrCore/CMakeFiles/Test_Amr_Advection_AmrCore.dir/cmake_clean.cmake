@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAllLevels.cpp.o"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAllLevels.cpp.o.d"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAtLevel.cpp.o"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AdvancePhiAtLevel.cpp.o.d"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AmrCoreAdv.cpp.o"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/AmrCoreAdv.cpp.o.d"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/DefineVelocity.cpp.o"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/DefineVelocity.cpp.o.d"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/main.cpp.o"
+  "CMakeFiles/Test_Amr_Advection_AmrCore.dir/Source/main.cpp.o.d"
+  "Test_Amr_Advection_AmrCore"
+  "Test_Amr_Advection_AmrCore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Amr_Advection_AmrCore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/Advection_AmrCore
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrCore
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Amr_Advection_AmrCore "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrCore/Test_Amr_Advection_AmrCore" "inputs-ci")
+set_tests_properties(Amr_Advection_AmrCore PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrCore" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/Advection_AmrCore/CMakeLists.txt;16;setup_test;/root/repo/Tests/Amr/Advection_AmrCore/CMakeLists.txt;0;")
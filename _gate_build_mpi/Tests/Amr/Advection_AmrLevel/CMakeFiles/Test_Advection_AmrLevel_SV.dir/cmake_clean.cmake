@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Exec/SingleVortex/Adv_prob.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Exec/SingleVortex/Adv_prob.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Exec/SingleVortex/Prob.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Exec/SingleVortex/Prob.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/Adv.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/Adv.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/AmrLevelAdv.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/AmrLevelAdv.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/LevelBldAdv.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/LevelBldAdv.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/Tagging_params.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/Tagging_params.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/bc_nullfill.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/bc_nullfill.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/main.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_SV.dir/Source/main.cpp.o.d"
+  "SingleVortex/Test_Advection_AmrLevel_SV"
+  "SingleVortex/Test_Advection_AmrLevel_SV.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Advection_AmrLevel_SV.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Exec/UniformVelocity/Adv_prob.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Adv_prob.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Adv_prob.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Exec/UniformVelocity/Prob.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Prob.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Prob.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Source/Adv.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Adv.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Adv.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Source/AmrLevelAdv.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/AmrLevelAdv.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/AmrLevelAdv.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Source/LevelBldAdv.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/LevelBldAdv.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/LevelBldAdv.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Source/Tagging_params.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Tagging_params.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Tagging_params.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Source/bc_nullfill.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/bc_nullfill.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/bc_nullfill.cpp.o.d"
+  "/root/repo/Tests/Amr/Advection_AmrLevel/Source/main.cpp" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/main.cpp.o" "gcc" "Tests/Amr/Advection_AmrLevel/CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mpi/Src/CMakeFiles/amrex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Adv_prob.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Adv_prob.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Prob.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Exec/UniformVelocity/Prob.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Adv.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Adv.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/AmrLevelAdv.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/AmrLevelAdv.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/LevelBldAdv.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/LevelBldAdv.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Tagging_params.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/Tagging_params.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/bc_nullfill.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/bc_nullfill.cpp.o.d"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/main.cpp.o"
+  "CMakeFiles/Test_Advection_AmrLevel_UV.dir/Source/main.cpp.o.d"
+  "UniformVelocity/Test_Advection_AmrLevel_UV"
+  "UniformVelocity/Test_Advection_AmrLevel_UV.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Advection_AmrLevel_UV.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
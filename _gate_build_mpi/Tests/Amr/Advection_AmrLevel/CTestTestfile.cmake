@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/Advection_AmrLevel
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrLevel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Advection_AmrLevel_SV "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrLevel/SingleVortex/Test_Advection_AmrLevel_SV" "inputs-ci")
+set_tests_properties(Advection_AmrLevel_SV PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrLevel/SingleVortex" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/Advection_AmrLevel/CMakeLists.txt;52;setup_test;/root/repo/Tests/Amr/Advection_AmrLevel/CMakeLists.txt;0;")
+add_test(Advection_AmrLevel_SV_Async "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrLevel/SingleVortex/Test_Advection_AmrLevel_SV" "inputs-ci-async")
+set_tests_properties(Advection_AmrLevel_SV_Async PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrLevel/SingleVortex" _BACKTRACE_TRIPLES "/root/repo/Tests/Amr/Advection_AmrLevel/CMakeLists.txt;57;add_test;/root/repo/Tests/Amr/Advection_AmrLevel/CMakeLists.txt;0;")
+add_test(Advection_AmrLevel_UV "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrLevel/UniformVelocity/Test_Advection_AmrLevel_UV" "inputs-ci")
+set_tests_properties(Advection_AmrLevel_UV PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/Advection_AmrLevel/UniformVelocity" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/Advection_AmrLevel/CMakeLists.txt;81;setup_test;/root/repo/Tests/Amr/Advection_AmrLevel/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Amr_FillPatchCache.dir/main.cpp.o"
+  "CMakeFiles/Test_Amr_FillPatchCache.dir/main.cpp.o.d"
+  "Test_Amr_FillPatchCache"
+  "Test_Amr_FillPatchCache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Amr_FillPatchCache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/FillPatchCache
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/FillPatchCache
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Amr_FillPatchCache "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchCache/Test_Amr_FillPatchCache" "inputs")
+set_tests_properties(Amr_FillPatchCache PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchCache" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/FillPatchCache/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/FillPatchCache/CMakeLists.txt;0;")
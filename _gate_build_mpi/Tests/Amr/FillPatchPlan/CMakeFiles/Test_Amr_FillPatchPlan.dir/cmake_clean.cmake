@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Amr_FillPatchPlan.dir/main.cpp.o"
+  "CMakeFiles/Test_Amr_FillPatchPlan.dir/main.cpp.o.d"
+  "Test_Amr_FillPatchPlan"
+  "Test_Amr_FillPatchPlan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Amr_FillPatchPlan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
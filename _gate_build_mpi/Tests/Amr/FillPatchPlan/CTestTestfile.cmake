@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/FillPatchPlan
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/FillPatchPlan
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Amr_FillPatchPlan "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchPlan/Test_Amr_FillPatchPlan" "inputs")
+set_tests_properties(Amr_FillPatchPlan PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchPlan" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/FillPatchPlan/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/FillPatchPlan/CMakeLists.txt;0;")
+add_test(Amr_FillPatchPlan_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchPlan/Test_Amr_FillPatchPlan" "inputs")
+set_tests_properties(Amr_FillPatchPlan_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchPlan" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Amr/FillPatchPlan/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/FillPatchPlan/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Amr_FillPatchThroughput.dir/main.cpp.o"
+  "CMakeFiles/Test_Amr_FillPatchThroughput.dir/main.cpp.o.d"
+  "Test_Amr_FillPatchThroughput"
+  "Test_Amr_FillPatchThroughput.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Amr_FillPatchThroughput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
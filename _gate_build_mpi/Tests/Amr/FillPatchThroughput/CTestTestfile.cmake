@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/FillPatchThroughput
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/FillPatchThroughput
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Amr_FillPatchThroughput "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchThroughput/Test_Amr_FillPatchThroughput")
+set_tests_properties(Amr_FillPatchThroughput PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/FillPatchThroughput" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/FillPatchThroughput/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/FillPatchThroughput/CMakeLists.txt;0;")
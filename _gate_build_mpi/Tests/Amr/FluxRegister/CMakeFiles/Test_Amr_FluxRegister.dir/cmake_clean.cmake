@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Amr_FluxRegister.dir/main.cpp.o"
+  "CMakeFiles/Test_Amr_FluxRegister.dir/main.cpp.o.d"
+  "Test_Amr_FluxRegister"
+  "Test_Amr_FluxRegister.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Amr_FluxRegister.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/FluxRegister
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/FluxRegister
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Amr_FluxRegister "/root/repo/_gate_build_mpi/Tests/Amr/FluxRegister/Test_Amr_FluxRegister" "inputs")
+set_tests_properties(Amr_FluxRegister PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/FluxRegister" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/FluxRegister/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/FluxRegister/CMakeLists.txt;0;")
+add_test(Amr_FluxRegister_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Amr/FluxRegister/Test_Amr_FluxRegister" "inputs")
+set_tests_properties(Amr_FluxRegister_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/FluxRegister" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Amr/FluxRegister/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/FluxRegister/CMakeLists.txt;0;")
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/RegridMetrics
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/RegridMetrics
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Amr_RegridMetrics "/root/repo/_gate_build_mpi/Tests/Amr/RegridMetrics/Test_Amr_RegridMetrics" "inputs")
+set_tests_properties(Amr_RegridMetrics PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/RegridMetrics" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/RegridMetrics/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/RegridMetrics/CMakeLists.txt;0;")
+add_test(Amr_RegridMetrics_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Amr/RegridMetrics/Test_Amr_RegridMetrics" "inputs")
+set_tests_properties(Amr_RegridMetrics_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/RegridMetrics" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Amr/RegridMetrics/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/RegridMetrics/CMakeLists.txt;0;")
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Amr/TagBox
+# Build directory: /root/repo/_gate_build_mpi/Tests/Amr/TagBox
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Amr_TagBox "/root/repo/_gate_build_mpi/Tests/Amr/TagBox/Test_Amr_TagBox" "inputs")
+set_tests_properties(Amr_TagBox PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/TagBox" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Amr/TagBox/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/TagBox/CMakeLists.txt;0;")
+add_test(Amr_TagBox_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Amr/TagBox/Test_Amr_TagBox" "inputs")
+set_tests_properties(Amr_TagBox_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Amr/TagBox" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Amr/TagBox/CMakeLists.txt;4;setup_test;/root/repo/Tests/Amr/TagBox/CMakeLists.txt;0;")
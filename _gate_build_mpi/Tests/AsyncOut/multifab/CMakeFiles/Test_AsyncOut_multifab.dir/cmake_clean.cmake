@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_AsyncOut_multifab.dir/main.cpp.o"
+  "CMakeFiles/Test_AsyncOut_multifab.dir/main.cpp.o.d"
+  "Test_AsyncOut_multifab"
+  "Test_AsyncOut_multifab.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_AsyncOut_multifab.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/AsyncOut/multifab
+# Build directory: /root/repo/_gate_build_mpi/Tests/AsyncOut/multifab
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(AsyncOut_multifab "/root/repo/_gate_build_mpi/Tests/AsyncOut/multifab/Test_AsyncOut_multifab" "inputs")
+set_tests_properties(AsyncOut_multifab PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/AsyncOut/multifab" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/AsyncOut/multifab/CMakeLists.txt;4;setup_test;/root/repo/Tests/AsyncOut/multifab/CMakeLists.txt;0;")
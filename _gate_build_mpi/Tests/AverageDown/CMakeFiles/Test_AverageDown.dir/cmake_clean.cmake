@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_AverageDown.dir/main.cpp.o"
+  "CMakeFiles/Test_AverageDown.dir/main.cpp.o.d"
+  "Test_AverageDown"
+  "Test_AverageDown.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_AverageDown.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
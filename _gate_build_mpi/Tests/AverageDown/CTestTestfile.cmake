@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/AverageDown
+# Build directory: /root/repo/_gate_build_mpi/Tests/AverageDown
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(AverageDown "/root/repo/_gate_build_mpi/Tests/AverageDown/Test_AverageDown" "inputs")
+set_tests_properties(AverageDown PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/AverageDown" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/AverageDown/CMakeLists.txt;4;setup_test;/root/repo/Tests/AverageDown/CMakeLists.txt;0;")
+add_test(AverageDown_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/AverageDown/Test_AverageDown" "inputs")
+set_tests_properties(AverageDown_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/AverageDown" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/AverageDown/CMakeLists.txt;4;setup_test;/root/repo/Tests/AverageDown/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_CLZ.dir/main.cpp.o"
+  "CMakeFiles/Test_CLZ.dir/main.cpp.o.d"
+  "Test_CLZ"
+  "Test_CLZ.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_CLZ.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
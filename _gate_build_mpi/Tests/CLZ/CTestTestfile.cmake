@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/CLZ
+# Build directory: /root/repo/_gate_build_mpi/Tests/CLZ
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CLZ "/root/repo/_gate_build_mpi/Tests/CLZ/Test_CLZ")
+set_tests_properties(CLZ PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/CLZ" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/CLZ/CMakeLists.txt;4;setup_test;/root/repo/Tests/CLZ/CMakeLists.txt;0;")
@@ -0,0 +1,52 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests
+# Build directory: /root/repo/_gate_build_mpi/Tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("AsyncOut/multifab")
+subdirs("MultiBlock/Advection")
+subdirs("MultiBlock/IndexType")
+subdirs("Amr/Advection_AmrCore")
+subdirs("Amr/Advection_AmrLevel")
+subdirs("Amr/FillPatchCache")
+subdirs("Amr/FillPatchPlan")
+subdirs("Amr/FillPatchThroughput")
+subdirs("Amr/FluxRegister")
+subdirs("Amr/RegridKeepOwners")
+subdirs("Amr/RegridMetrics")
+subdirs("Amr/TagBox")
+subdirs("CLZ")
+subdirs("Parser")
+subdirs("AverageDown")
+subdirs("Particles/AssignDensity")
+subdirs("Particles/AssignMultiLevelDensity")
+subdirs("Particles/AsyncIO")
+subdirs("Particles/DenseBins")
+subdirs("Particles/GhostsAndVirtuals")
+subdirs("Particles/InitFromAscii")
+subdirs("Particles/Intersection")
+subdirs("Particles/NearGrid")
+subdirs("Particles/NeighborParticles")
+subdirs("Particles/ParallelContext")
+subdirs("Particles/ParticleArray")
+subdirs("Particles/ParticleCosts")
+subdirs("Particles/ParticleIDs")
+subdirs("Particles/ParticleIterator")
+subdirs("Particles/ParticleLayout")
+subdirs("Particles/ParticleMesh")
+subdirs("Particles/ParticleMeshMultiLevel")
+subdirs("Particles/ParticleReduce")
+subdirs("Particles/ParticleTransformations")
+subdirs("Particles/Redistribute")
+subdirs("Particles/SparseBins")
+subdirs("Particles/TypeDescriptor")
+subdirs("LinearSolvers/ABecLaplacian_C")
+subdirs("LinearSolvers/ABecLaplacian_F")
+subdirs("LinearSolvers/AutoTune")
+subdirs("LinearSolvers/CoeffUpdate")
+subdirs("LinearSolvers/FusedCycle")
+subdirs("LinearSolvers/GSRB")
+subdirs("LinearSolvers/NodalPoisson")
+subdirs("LinearSolvers/Nodal_Projection_EB")
+subdirs("LinearSolvers/NodeTensorLap")
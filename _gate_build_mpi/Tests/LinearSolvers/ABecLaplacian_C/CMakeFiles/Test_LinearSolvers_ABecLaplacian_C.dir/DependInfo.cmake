@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/LinearSolvers/ABecLaplacian_C/MyTest.cpp" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTest.cpp.o" "gcc" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTest.cpp.o.d"
+  "/root/repo/Tests/LinearSolvers/ABecLaplacian_C/MyTestPlotfile.cpp" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTestPlotfile.cpp.o" "gcc" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTestPlotfile.cpp.o.d"
+  "/root/repo/Tests/LinearSolvers/ABecLaplacian_C/initProb.cpp" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/initProb.cpp.o" "gcc" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/initProb.cpp.o.d"
+  "/root/repo/Tests/LinearSolvers/ABecLaplacian_C/main.cpp" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/main.cpp.o" "gcc" "Tests/LinearSolvers/ABecLaplacian_C/CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mpi/Src/CMakeFiles/amrex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTest.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTest.cpp.o.d"
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTestPlotfile.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/MyTestPlotfile.cpp.o.d"
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/initProb.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/initProb.cpp.o.d"
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/main.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/main.cpp.o.d"
+  "Test_LinearSolvers_ABecLaplacian_C"
+  "Test_LinearSolvers_ABecLaplacian_C.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_LinearSolvers_ABecLaplacian_C.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/ABecLaplacian_C
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/ABecLaplacian_C
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearSolvers_ABecLaplacian_C "/root/repo/_gate_build_mpi/Tests/LinearSolvers/ABecLaplacian_C/Test_LinearSolvers_ABecLaplacian_C")
+set_tests_properties(LinearSolvers_ABecLaplacian_C PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/ABecLaplacian_C" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/LinearSolvers/ABecLaplacian_C/CMakeLists.txt;15;setup_test;/root/repo/Tests/LinearSolvers/ABecLaplacian_C/CMakeLists.txt;0;")
+add_test(LinearSolvers_ABecLaplacian_C_GMRES "/root/repo/_gate_build_mpi/Tests/LinearSolvers/ABecLaplacian_C/Test_LinearSolvers_ABecLaplacian_C" "inputs-gmres")
+set_tests_properties(LinearSolvers_ABecLaplacian_C_GMRES PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/ABecLaplacian_C" _BACKTRACE_TRIPLES "/root/repo/Tests/LinearSolvers/ABecLaplacian_C/CMakeLists.txt;19;add_test;/root/repo/Tests/LinearSolvers/ABecLaplacian_C/CMakeLists.txt;0;")
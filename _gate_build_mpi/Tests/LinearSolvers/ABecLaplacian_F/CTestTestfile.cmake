@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/ABecLaplacian_F
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/ABecLaplacian_F
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
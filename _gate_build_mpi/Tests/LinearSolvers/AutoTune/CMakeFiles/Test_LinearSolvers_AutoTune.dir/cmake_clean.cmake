@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_LinearSolvers_AutoTune.dir/main.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_AutoTune.dir/main.cpp.o.d"
+  "Test_LinearSolvers_AutoTune"
+  "Test_LinearSolvers_AutoTune.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_LinearSolvers_AutoTune.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
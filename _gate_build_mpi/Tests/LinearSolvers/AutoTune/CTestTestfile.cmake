@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/AutoTune
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/AutoTune
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearSolvers_AutoTune "/root/repo/_gate_build_mpi/Tests/LinearSolvers/AutoTune/Test_LinearSolvers_AutoTune" "inputs")
+set_tests_properties(LinearSolvers_AutoTune PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/AutoTune" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/LinearSolvers/AutoTune/CMakeLists.txt;8;setup_test;/root/repo/Tests/LinearSolvers/AutoTune/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_LinearSolvers_CoeffUpdate.dir/main.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_CoeffUpdate.dir/main.cpp.o.d"
+  "Test_LinearSolvers_CoeffUpdate"
+  "Test_LinearSolvers_CoeffUpdate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_LinearSolvers_CoeffUpdate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/CoeffUpdate
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/CoeffUpdate
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearSolvers_CoeffUpdate "/root/repo/_gate_build_mpi/Tests/LinearSolvers/CoeffUpdate/Test_LinearSolvers_CoeffUpdate" "inputs")
+set_tests_properties(LinearSolvers_CoeffUpdate PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/CoeffUpdate" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/LinearSolvers/CoeffUpdate/CMakeLists.txt;8;setup_test;/root/repo/Tests/LinearSolvers/CoeffUpdate/CMakeLists.txt;0;")
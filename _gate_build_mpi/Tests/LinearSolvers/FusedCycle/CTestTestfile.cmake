@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/FusedCycle
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/FusedCycle
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearSolvers_FusedCycle "/root/repo/_gate_build_mpi/Tests/LinearSolvers/FusedCycle/Test_LinearSolvers_FusedCycle" "inputs")
+set_tests_properties(LinearSolvers_FusedCycle PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/FusedCycle" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/LinearSolvers/FusedCycle/CMakeLists.txt;8;setup_test;/root/repo/Tests/LinearSolvers/FusedCycle/CMakeLists.txt;0;")
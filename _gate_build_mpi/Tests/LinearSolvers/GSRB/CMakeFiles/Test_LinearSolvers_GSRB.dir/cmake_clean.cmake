@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_LinearSolvers_GSRB.dir/main.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_GSRB.dir/main.cpp.o.d"
+  "Test_LinearSolvers_GSRB"
+  "Test_LinearSolvers_GSRB.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_LinearSolvers_GSRB.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/GSRB
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/GSRB
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearSolvers_GSRB "/root/repo/_gate_build_mpi/Tests/LinearSolvers/GSRB/Test_LinearSolvers_GSRB" "inputs")
+set_tests_properties(LinearSolvers_GSRB PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/GSRB" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/LinearSolvers/GSRB/CMakeLists.txt;8;setup_test;/root/repo/Tests/LinearSolvers/GSRB/CMakeLists.txt;0;")
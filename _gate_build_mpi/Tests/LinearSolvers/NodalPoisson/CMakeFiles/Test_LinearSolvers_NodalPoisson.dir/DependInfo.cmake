@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/LinearSolvers/NodalPoisson/MyTest.cpp" "Tests/LinearSolvers/NodalPoisson/CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTest.cpp.o" "gcc" "Tests/LinearSolvers/NodalPoisson/CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTest.cpp.o.d"
+  "/root/repo/Tests/LinearSolvers/NodalPoisson/MyTestPlotfile.cpp" "Tests/LinearSolvers/NodalPoisson/CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTestPlotfile.cpp.o" "gcc" "Tests/LinearSolvers/NodalPoisson/CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTestPlotfile.cpp.o.d"
+  "/root/repo/Tests/LinearSolvers/NodalPoisson/main.cpp" "Tests/LinearSolvers/NodalPoisson/CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/main.cpp.o" "gcc" "Tests/LinearSolvers/NodalPoisson/CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mpi/Src/CMakeFiles/amrex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
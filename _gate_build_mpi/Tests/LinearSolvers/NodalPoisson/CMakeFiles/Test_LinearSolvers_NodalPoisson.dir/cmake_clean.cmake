@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTest.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTest.cpp.o.d"
+  "CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTestPlotfile.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/MyTestPlotfile.cpp.o.d"
+  "CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/main.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/main.cpp.o.d"
+  "Test_LinearSolvers_NodalPoisson"
+  "Test_LinearSolvers_NodalPoisson.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_LinearSolvers_NodalPoisson.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/NodalPoisson
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/NodalPoisson
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearSolvers_NodalPoisson "/root/repo/_gate_build_mpi/Tests/LinearSolvers/NodalPoisson/Test_LinearSolvers_NodalPoisson" "inputs-ci")
+set_tests_properties(LinearSolvers_NodalPoisson PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/NodalPoisson" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/LinearSolvers/NodalPoisson/CMakeLists.txt;9;setup_test;/root/repo/Tests/LinearSolvers/NodalPoisson/CMakeLists.txt;0;")
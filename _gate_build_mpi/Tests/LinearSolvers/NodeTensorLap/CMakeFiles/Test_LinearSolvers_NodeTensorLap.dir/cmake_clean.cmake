@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/MyTest.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/MyTest.cpp.o.d"
+  "CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/MyTestPlotfile.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/MyTestPlotfile.cpp.o.d"
+  "CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/main.cpp.o"
+  "CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/main.cpp.o.d"
+  "Test_LinearSolvers_NodeTensorLap"
+  "Test_LinearSolvers_NodeTensorLap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_LinearSolvers_NodeTensorLap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
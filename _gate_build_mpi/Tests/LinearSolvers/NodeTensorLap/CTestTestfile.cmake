@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/LinearSolvers/NodeTensorLap
+# Build directory: /root/repo/_gate_build_mpi/Tests/LinearSolvers/NodeTensorLap
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearSolvers_NodeTensorLap "/root/repo/_gate_build_mpi/Tests/LinearSolvers/NodeTensorLap/Test_LinearSolvers_NodeTensorLap")
+set_tests_properties(LinearSolvers_NodeTensorLap PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/LinearSolvers/NodeTensorLap" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/LinearSolvers/NodeTensorLap/CMakeLists.txt;5;setup_test;/root/repo/Tests/LinearSolvers/NodeTensorLap/CMakeLists.txt;0;")
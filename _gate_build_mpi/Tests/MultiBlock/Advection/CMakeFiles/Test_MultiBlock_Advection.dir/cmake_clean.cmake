@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_MultiBlock_Advection.dir/main.cpp.o"
+  "CMakeFiles/Test_MultiBlock_Advection.dir/main.cpp.o.d"
+  "Test_MultiBlock_Advection"
+  "Test_MultiBlock_Advection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_MultiBlock_Advection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
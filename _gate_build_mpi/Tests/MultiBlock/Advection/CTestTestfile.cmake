@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/MultiBlock/Advection
+# Build directory: /root/repo/_gate_build_mpi/Tests/MultiBlock/Advection
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(MultiBlock_Advection "/root/repo/_gate_build_mpi/Tests/MultiBlock/Advection/Test_MultiBlock_Advection")
+set_tests_properties(MultiBlock_Advection PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/MultiBlock/Advection" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/MultiBlock/Advection/CMakeLists.txt;8;setup_test;/root/repo/Tests/MultiBlock/Advection/CMakeLists.txt;0;")
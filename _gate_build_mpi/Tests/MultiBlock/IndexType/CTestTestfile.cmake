@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/MultiBlock/IndexType
+# Build directory: /root/repo/_gate_build_mpi/Tests/MultiBlock/IndexType
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(MultiBlock_IndexType "/root/repo/_gate_build_mpi/Tests/MultiBlock/IndexType/Test_MultiBlock_IndexType")
+set_tests_properties(MultiBlock_IndexType PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/MultiBlock/IndexType" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/MultiBlock/IndexType/CMakeLists.txt;8;setup_test;/root/repo/Tests/MultiBlock/IndexType/CMakeLists.txt;0;")
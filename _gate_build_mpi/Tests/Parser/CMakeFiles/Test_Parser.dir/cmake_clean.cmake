@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Parser.dir/main.cpp.o"
+  "CMakeFiles/Test_Parser.dir/main.cpp.o.d"
+  "Test_Parser"
+  "Test_Parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Parser
+# Build directory: /root/repo/_gate_build_mpi/Tests/Parser
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Parser "/root/repo/_gate_build_mpi/Tests/Parser/Test_Parser")
+set_tests_properties(Parser PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Parser" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Parser/CMakeLists.txt;4;setup_test;/root/repo/Tests/Parser/CMakeLists.txt;0;")
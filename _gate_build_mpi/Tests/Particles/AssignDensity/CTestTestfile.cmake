@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/AssignDensity
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/AssignDensity
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_AssignDensity "/root/repo/_gate_build_mpi/Tests/Particles/AssignDensity/Test_Particles_AssignDensity" "inputs")
+set_tests_properties(Particles_AssignDensity PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/AssignDensity" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/AssignDensity/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/AssignDensity/CMakeLists.txt;0;")
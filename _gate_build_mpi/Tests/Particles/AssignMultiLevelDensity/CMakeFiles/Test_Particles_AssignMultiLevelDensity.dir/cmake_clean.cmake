@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_AssignMultiLevelDensity.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_AssignMultiLevelDensity.dir/main.cpp.o.d"
+  "Test_Particles_AssignMultiLevelDensity"
+  "Test_Particles_AssignMultiLevelDensity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_AssignMultiLevelDensity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/AssignMultiLevelDensity
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/AssignMultiLevelDensity
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_AssignMultiLevelDensity "/root/repo/_gate_build_mpi/Tests/Particles/AssignMultiLevelDensity/Test_Particles_AssignMultiLevelDensity" "inputs")
+set_tests_properties(Particles_AssignMultiLevelDensity PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/AssignMultiLevelDensity" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/AssignMultiLevelDensity/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/AssignMultiLevelDensity/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_AsyncIO.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_AsyncIO.dir/main.cpp.o.d"
+  "Test_Particles_AsyncIO"
+  "Test_Particles_AsyncIO.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_AsyncIO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
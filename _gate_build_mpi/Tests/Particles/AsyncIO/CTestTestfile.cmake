@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/AsyncIO
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/AsyncIO
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_AsyncIO "/root/repo/_gate_build_mpi/Tests/Particles/AsyncIO/Test_Particles_AsyncIO" "inputs")
+set_tests_properties(Particles_AsyncIO PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/AsyncIO" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/AsyncIO/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/AsyncIO/CMakeLists.txt;0;")
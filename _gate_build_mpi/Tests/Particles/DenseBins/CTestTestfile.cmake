@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/DenseBins
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/DenseBins
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_DenseBins "/root/repo/_gate_build_mpi/Tests/Particles/DenseBins/Test_Particles_DenseBins" "inputs")
+set_tests_properties(Particles_DenseBins PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/DenseBins" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/DenseBins/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/DenseBins/CMakeLists.txt;0;")
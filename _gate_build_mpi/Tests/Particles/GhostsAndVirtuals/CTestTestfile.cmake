@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/GhostsAndVirtuals
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/GhostsAndVirtuals
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_GhostsAndVirtuals "/root/repo/_gate_build_mpi/Tests/Particles/GhostsAndVirtuals/Test_Particles_GhostsAndVirtuals" "inputs")
+set_tests_properties(Particles_GhostsAndVirtuals PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/GhostsAndVirtuals" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/GhostsAndVirtuals/CMakeLists.txt;8;setup_test;/root/repo/Tests/Particles/GhostsAndVirtuals/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/InitFromAscii
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/InitFromAscii
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_InitFromAscii "/root/repo/_gate_build_mpi/Tests/Particles/InitFromAscii/Test_Particles_InitFromAscii" "inputs")
+set_tests_properties(Particles_InitFromAscii PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/InitFromAscii" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/InitFromAscii/CMakeLists.txt;8;setup_test;/root/repo/Tests/Particles/InitFromAscii/CMakeLists.txt;0;")
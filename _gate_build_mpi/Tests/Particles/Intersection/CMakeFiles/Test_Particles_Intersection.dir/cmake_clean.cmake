@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_Intersection.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_Intersection.dir/main.cpp.o.d"
+  "Test_Particles_Intersection"
+  "Test_Particles_Intersection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_Intersection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/Intersection
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/Intersection
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_Intersection "/root/repo/_gate_build_mpi/Tests/Particles/Intersection/Test_Particles_Intersection" "inputs")
+set_tests_properties(Particles_Intersection PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/Intersection" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/Intersection/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/Intersection/CMakeLists.txt;0;")
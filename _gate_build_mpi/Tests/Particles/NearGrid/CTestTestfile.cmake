@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/NearGrid
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/NearGrid
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_NearGrid "/root/repo/_gate_build_mpi/Tests/Particles/NearGrid/Test_Particles_NearGrid" "inputs")
+set_tests_properties(Particles_NearGrid PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/NearGrid" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/NearGrid/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/NearGrid/CMakeLists.txt;0;")
+add_test(Particles_NearGrid_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Particles/NearGrid/Test_Particles_NearGrid" "inputs")
+set_tests_properties(Particles_NearGrid_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/NearGrid" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Particles/NearGrid/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/NearGrid/CMakeLists.txt;0;")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Tests/Particles/NeighborParticles/MDParticleContainer.cpp" "Tests/Particles/NeighborParticles/CMakeFiles/Test_Particles_NeighborParticles.dir/MDParticleContainer.cpp.o" "gcc" "Tests/Particles/NeighborParticles/CMakeFiles/Test_Particles_NeighborParticles.dir/MDParticleContainer.cpp.o.d"
+  "/root/repo/Tests/Particles/NeighborParticles/main.cpp" "Tests/Particles/NeighborParticles/CMakeFiles/Test_Particles_NeighborParticles.dir/main.cpp.o" "gcc" "Tests/Particles/NeighborParticles/CMakeFiles/Test_Particles_NeighborParticles.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mpi/Src/CMakeFiles/amrex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
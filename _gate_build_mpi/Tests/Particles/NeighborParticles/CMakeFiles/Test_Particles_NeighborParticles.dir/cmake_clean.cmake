@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_NeighborParticles.dir/MDParticleContainer.cpp.o"
+  "CMakeFiles/Test_Particles_NeighborParticles.dir/MDParticleContainer.cpp.o.d"
+  "CMakeFiles/Test_Particles_NeighborParticles.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_NeighborParticles.dir/main.cpp.o.d"
+  "Test_Particles_NeighborParticles"
+  "Test_Particles_NeighborParticles.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_NeighborParticles.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/NeighborParticles
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/NeighborParticles
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_NeighborParticles "/root/repo/_gate_build_mpi/Tests/Particles/NeighborParticles/Test_Particles_NeighborParticles" "inputs")
+set_tests_properties(Particles_NeighborParticles PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/NeighborParticles" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/NeighborParticles/CMakeLists.txt;5;setup_test;/root/repo/Tests/Particles/NeighborParticles/CMakeLists.txt;0;")
+add_test(Particles_NeighborParticles_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Particles/NeighborParticles/Test_Particles_NeighborParticles" "inputs")
+set_tests_properties(Particles_NeighborParticles_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/NeighborParticles" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Particles/NeighborParticles/CMakeLists.txt;5;setup_test;/root/repo/Tests/Particles/NeighborParticles/CMakeLists.txt;0;")
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParallelContext
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParallelContext
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParallelContext "/root/repo/_gate_build_mpi/Tests/Particles/ParallelContext/Test_Particles_ParallelContext" "inputs.rt")
+set_tests_properties(Particles_ParallelContext PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParallelContext" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParallelContext/CMakeLists.txt;8;setup_test;/root/repo/Tests/Particles/ParallelContext/CMakeLists.txt;0;")
+add_test(Particles_ParallelContext_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Particles/ParallelContext/Test_Particles_ParallelContext" "inputs.rt")
+set_tests_properties(Particles_ParallelContext_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParallelContext" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Particles/ParallelContext/CMakeLists.txt;8;setup_test;/root/repo/Tests/Particles/ParallelContext/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleArray
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleArray
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleArray "/root/repo/_gate_build_mpi/Tests/Particles/ParticleArray/Test_Particles_ParticleArray")
+set_tests_properties(Particles_ParticleArray PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleArray" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleArray/CMakeLists.txt;3;setup_test;/root/repo/Tests/Particles/ParticleArray/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_ParticleCosts.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_ParticleCosts.dir/main.cpp.o.d"
+  "Test_Particles_ParticleCosts"
+  "Test_Particles_ParticleCosts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_ParticleCosts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleIDs
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleIDs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleIDs "/root/repo/_gate_build_mpi/Tests/Particles/ParticleIDs/Test_Particles_ParticleIDs" "inputs")
+set_tests_properties(Particles_ParticleIDs PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleIDs" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleIDs/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/ParticleIDs/CMakeLists.txt;0;")
+add_test(Particles_ParticleIDs_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Particles/ParticleIDs/Test_Particles_ParticleIDs" "inputs")
+set_tests_properties(Particles_ParticleIDs_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleIDs" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Particles/ParticleIDs/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/ParticleIDs/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleIterator
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleIterator
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleIterator "/root/repo/_gate_build_mpi/Tests/Particles/ParticleIterator/Test_Particles_ParticleIterator")
+set_tests_properties(Particles_ParticleIterator PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleIterator" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleIterator/CMakeLists.txt;3;setup_test;/root/repo/Tests/Particles/ParticleIterator/CMakeLists.txt;0;")
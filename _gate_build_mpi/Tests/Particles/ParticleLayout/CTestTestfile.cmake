@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleLayout
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleLayout
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleLayout "/root/repo/_gate_build_mpi/Tests/Particles/ParticleLayout/Test_Particles_ParticleLayout" "inputs")
+set_tests_properties(Particles_ParticleLayout PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleLayout" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleLayout/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/ParticleLayout/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleMesh
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleMesh
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleMesh "/root/repo/_gate_build_mpi/Tests/Particles/ParticleMesh/Test_Particles_ParticleMesh" "inputs")
+set_tests_properties(Particles_ParticleMesh PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleMesh" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleMesh/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/ParticleMesh/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleMeshMultiLevel
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleMeshMultiLevel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleMeshMultiLevel "/root/repo/_gate_build_mpi/Tests/Particles/ParticleMeshMultiLevel/Test_Particles_ParticleMeshMultiLevel" "inputs")
+set_tests_properties(Particles_ParticleMeshMultiLevel PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleMeshMultiLevel" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleMeshMultiLevel/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/ParticleMeshMultiLevel/CMakeLists.txt;0;")
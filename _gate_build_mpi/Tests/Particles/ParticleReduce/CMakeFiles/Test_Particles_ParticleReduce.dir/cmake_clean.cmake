@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_ParticleReduce.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_ParticleReduce.dir/main.cpp.o.d"
+  "Test_Particles_ParticleReduce"
+  "Test_Particles_ParticleReduce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_ParticleReduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
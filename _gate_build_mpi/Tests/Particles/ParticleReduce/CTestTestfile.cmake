@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleReduce
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleReduce
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleReduce "/root/repo/_gate_build_mpi/Tests/Particles/ParticleReduce/Test_Particles_ParticleReduce" "inputs")
+set_tests_properties(Particles_ParticleReduce PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleReduce" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleReduce/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/ParticleReduce/CMakeLists.txt;0;")
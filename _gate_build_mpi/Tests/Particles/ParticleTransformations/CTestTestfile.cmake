@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/ParticleTransformations
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/ParticleTransformations
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_ParticleTransformations "/root/repo/_gate_build_mpi/Tests/Particles/ParticleTransformations/Test_Particles_ParticleTransformations" "inputs")
+set_tests_properties(Particles_ParticleTransformations PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/ParticleTransformations" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/ParticleTransformations/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/ParticleTransformations/CMakeLists.txt;0;")
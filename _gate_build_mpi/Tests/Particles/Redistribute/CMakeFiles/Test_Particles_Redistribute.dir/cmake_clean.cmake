@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_Redistribute.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_Redistribute.dir/main.cpp.o.d"
+  "Test_Particles_Redistribute"
+  "Test_Particles_Redistribute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_Redistribute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
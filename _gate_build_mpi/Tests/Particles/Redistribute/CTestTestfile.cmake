@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/Redistribute
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/Redistribute
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_Redistribute "/root/repo/_gate_build_mpi/Tests/Particles/Redistribute/Test_Particles_Redistribute" "inputs.rt")
+set_tests_properties(Particles_Redistribute PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/Redistribute" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/Redistribute/CMakeLists.txt;8;setup_test;/root/repo/Tests/Particles/Redistribute/CMakeLists.txt;0;")
+add_test(Particles_Redistribute_MPI "mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/Tests/Particles/Redistribute/Test_Particles_Redistribute" "inputs.rt")
+set_tests_properties(Particles_Redistribute_MPI PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=1" WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/Redistribute" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;121;add_test;/root/repo/Tests/Particles/Redistribute/CMakeLists.txt;8;setup_test;/root/repo/Tests/Particles/Redistribute/CMakeLists.txt;0;")
+add_test(Particles_Redistribute_Tiled "/root/repo/_gate_build_mpi/Tests/Particles/Redistribute/Test_Particles_Redistribute" "inputs.rt.tiled")
+set_tests_properties(Particles_Redistribute_Tiled PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/Redistribute" _BACKTRACE_TRIPLES "/root/repo/Tests/Particles/Redistribute/CMakeLists.txt;12;add_test;/root/repo/Tests/Particles/Redistribute/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/SparseBins
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/SparseBins
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_SparseBins "/root/repo/_gate_build_mpi/Tests/Particles/SparseBins/Test_Particles_SparseBins" "inputs")
+set_tests_properties(Particles_SparseBins PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/SparseBins" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/SparseBins/CMakeLists.txt;4;setup_test;/root/repo/Tests/Particles/SparseBins/CMakeLists.txt;0;")
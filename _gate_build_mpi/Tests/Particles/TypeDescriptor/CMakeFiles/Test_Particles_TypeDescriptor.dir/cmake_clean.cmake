@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Test_Particles_TypeDescriptor.dir/main.cpp.o"
+  "CMakeFiles/Test_Particles_TypeDescriptor.dir/main.cpp.o.d"
+  "Test_Particles_TypeDescriptor"
+  "Test_Particles_TypeDescriptor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test_Particles_TypeDescriptor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Tests/Particles/TypeDescriptor
+# Build directory: /root/repo/_gate_build_mpi/Tests/Particles/TypeDescriptor
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Particles_TypeDescriptor "/root/repo/_gate_build_mpi/Tests/Particles/TypeDescriptor/Test_Particles_TypeDescriptor")
+set_tests_properties(Particles_TypeDescriptor PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/Tests/Particles/TypeDescriptor" _BACKTRACE_TRIPLES "/root/repo/Tests/CMakeLists.txt;107;add_test;/root/repo/Tests/Particles/TypeDescriptor/CMakeLists.txt;3;setup_test;/root/repo/Tests/Particles/TypeDescriptor/CMakeLists.txt;0;")
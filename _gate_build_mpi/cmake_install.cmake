@@ -0,0 +1,384 @@
+# Install script for directory: /root/repo
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/root/repo/installdir")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_gate_build_mpi/Src/cmake_install.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/AMReX" TYPE FILE FILES
+    "/root/repo/_gate_build_mpi/lib/cmake/AMReX/AMReXConfig.cmake"
+    "/root/repo/_gate_build_mpi/lib/cmake/AMReX/AMReXConfigVersion.cmake"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_gate_build_mpi/Src/libamrex.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE FILE FILES
+    "/root/repo/Src/Base/AMReX_ccse-mpi.H"
+    "/root/repo/Src/Base/AMReX_Math.H"
+    "/root/repo/Src/Base/AMReX_Algorithm.H"
+    "/root/repo/Src/Base/AMReX_Array.H"
+    "/root/repo/Src/Base/AMReX_BlockMutex.H"
+    "/root/repo/Src/Base/AMReX_GpuComplex.H"
+    "/root/repo/Src/Base/AMReX_Vector.H"
+    "/root/repo/Src/Base/AMReX_Tuple.H"
+    "/root/repo/Src/Base/AMReX.H"
+    "/root/repo/Src/Base/AMReX_Exception.H"
+    "/root/repo/Src/Base/AMReX_Extension.H"
+    "/root/repo/Src/Base/AMReX_PODVector.H"
+    "/root/repo/Src/Base/AMReX_ParmParse.H"
+    "/root/repo/Src/Base/AMReX_Functional.H"
+    "/root/repo/Src/Base/AMReX_Utility.H"
+    "/root/repo/Src/Base/AMReX_FileSystem.H"
+    "/root/repo/Src/Base/AMReX_Reduce.H"
+    "/root/repo/Src/Base/AMReX_Scan.H"
+    "/root/repo/Src/Base/AMReX_Partition.H"
+    "/root/repo/Src/Base/AMReX_Morton.H"
+    "/root/repo/Src/Base/AMReX_Random.H"
+    "/root/repo/Src/Base/AMReX_RandomEngine.H"
+    "/root/repo/Src/Base/AMReX_BLassert.H"
+    "/root/repo/Src/Base/AMReX_ArrayLim.H"
+    "/root/repo/Src/Base/AMReX_REAL.H"
+    "/root/repo/Src/Base/AMReX_INT.H"
+    "/root/repo/Src/Base/AMReX_CONSTANTS.H"
+    "/root/repo/Src/Base/AMReX_SPACE.H"
+    "/root/repo/Src/Base/AMReX_DistributionMapping.H"
+    "/root/repo/Src/Base/AMReX_ParallelDescriptor.H"
+    "/root/repo/Src/Base/AMReX_OpenMP.H"
+    "/root/repo/Src/Base/AMReX_ParallelReduce.H"
+    "/root/repo/Src/Base/AMReX_ForkJoin.H"
+    "/root/repo/Src/Base/AMReX_ParallelContext.H"
+    "/root/repo/Src/Base/AMReX_VisMFBuffer.H"
+    "/root/repo/Src/Base/AMReX_VisMF.H"
+    "/root/repo/Src/Base/AMReX_AsyncOut.H"
+    "/root/repo/Src/Base/AMReX_BackgroundThread.H"
+    "/root/repo/Src/Base/AMReX_Arena.H"
+    "/root/repo/Src/Base/AMReX_BArena.H"
+    "/root/repo/Src/Base/AMReX_CArena.H"
+    "/root/repo/Src/Base/AMReX_PArena.H"
+    "/root/repo/Src/Base/AMReX_BLProfiler.H"
+    "/root/repo/Src/Base/AMReX_BLBackTrace.H"
+    "/root/repo/Src/Base/AMReX_BLFort.H"
+    "/root/repo/Src/Base/AMReX_NFiles.H"
+    "/root/repo/Src/Base/AMReX_parstream.H"
+    "/root/repo/Src/Base/AMReX_ANSIEscCode.H"
+    "/root/repo/Src/Base/AMReX_FabConv.H"
+    "/root/repo/Src/Base/AMReX_FPC.H"
+    "/root/repo/Src/Base/AMReX_VectorIO.H"
+    "/root/repo/Src/Base/AMReX_Print.H"
+    "/root/repo/Src/Base/AMReX_IntConv.H"
+    "/root/repo/Src/Base/AMReX_Box.H"
+    "/root/repo/Src/Base/AMReX_BoxIterator.H"
+    "/root/repo/Src/Base/AMReX_Dim3.H"
+    "/root/repo/Src/Base/AMReX_IntVect.H"
+    "/root/repo/Src/Base/AMReX_IndexType.H"
+    "/root/repo/Src/Base/AMReX_Loop.H"
+    "/root/repo/Src/Base/AMReX_Orientation.H"
+    "/root/repo/Src/Base/AMReX_Periodicity.H"
+    "/root/repo/Src/Base/AMReX_RealBox.H"
+    "/root/repo/Src/Base/AMReX_RealVect.H"
+    "/root/repo/Src/Base/AMReX_BoxList.H"
+    "/root/repo/Src/Base/AMReX_BoxArray.H"
+    "/root/repo/Src/Base/AMReX_BoxDomain.H"
+    "/root/repo/Src/Base/AMReX_FArrayBox.H"
+    "/root/repo/Src/Base/AMReX_IArrayBox.H"
+    "/root/repo/Src/Base/AMReX_BaseFab.H"
+    "/root/repo/Src/Base/AMReX_Array4.H"
+    "/root/repo/Src/Base/AMReX_MakeType.H"
+    "/root/repo/Src/Base/AMReX_TypeTraits.H"
+    "/root/repo/Src/Base/AMReX_FabFactory.H"
+    "/root/repo/Src/Base/AMReX_BaseFabUtility.H"
+    "/root/repo/Src/Base/AMReX_MultiFab.H"
+    "/root/repo/Src/Base/AMReX_MFCopyDescriptor.H"
+    "/root/repo/Src/Base/AMReX_iMultiFab.H"
+    "/root/repo/Src/Base/AMReX_FabArrayBase.H"
+    "/root/repo/Src/Base/AMReX_MFIter.H"
+    "/root/repo/Src/Base/AMReX_FabArray.H"
+    "/root/repo/Src/Base/AMReX_FACopyDescriptor.H"
+    "/root/repo/Src/Base/AMReX_FabArrayCommI.H"
+    "/root/repo/Src/Base/AMReX_FBI.H"
+    "/root/repo/Src/Base/AMReX_PCI.H"
+    "/root/repo/Src/Base/AMReX_FabArrayUtility.H"
+    "/root/repo/Src/Base/AMReX_LayoutData.H"
+    "/root/repo/Src/Base/AMReX_CoordSys.H"
+    "/root/repo/Src/Base/AMReX_COORDSYS_3D_C.H"
+    "/root/repo/Src/Base/AMReX_COORDSYS_C.H"
+    "/root/repo/Src/Base/AMReX_Geometry.H"
+    "/root/repo/Src/Base/AMReX_MultiFabUtil.H"
+    "/root/repo/Src/Base/AMReX_MultiFabUtilI.H"
+    "/root/repo/Src/Base/AMReX_MultiFabUtil_3D_C.H"
+    "/root/repo/Src/Base/AMReX_MultiFabUtil_nd_C.H"
+    "/root/repo/Src/Base/AMReX_MultiFabUtil_C.H"
+    "/root/repo/Src/Base/AMReX_BCRec.H"
+    "/root/repo/Src/Base/AMReX_PhysBCFunct.H"
+    "/root/repo/Src/Base/AMReX_BCUtil.H"
+    "/root/repo/Src/Base/AMReX_BC_TYPES.H"
+    "/root/repo/Src/Base/AMReX_FilCC_3D_C.H"
+    "/root/repo/Src/Base/AMReX_FilCC_C.H"
+    "/root/repo/Src/Base/AMReX_FilFC_3D_C.H"
+    "/root/repo/Src/Base/AMReX_FilFC_C.H"
+    "/root/repo/Src/Base/AMReX_FilND_C.H"
+    "/root/repo/Src/Base/AMReX_NonLocalBC.H"
+    "/root/repo/Src/Base/AMReX_NonLocalBCImpl.H"
+    "/root/repo/Src/Base/AMReX_PlotFileUtil.H"
+    "/root/repo/Src/Base/AMReX_PlotFileDataImpl.H"
+    "/root/repo/Src/Base/AMReX_FEIntegrator.H"
+    "/root/repo/Src/Base/AMReX_IntegratorBase.H"
+    "/root/repo/Src/Base/AMReX_RKIntegrator.H"
+    "/root/repo/Src/Base/AMReX_TimeIntegrator.H"
+    "/root/repo/Src/Base/AMReX_Gpu.H"
+    "/root/repo/Src/Base/AMReX_GpuQualifiers.H"
+    "/root/repo/Src/Base/AMReX_GpuKernelInfo.H"
+    "/root/repo/Src/Base/AMReX_GpuPrint.H"
+    "/root/repo/Src/Base/AMReX_GpuAssert.H"
+    "/root/repo/Src/Base/AMReX_GpuTypes.H"
+    "/root/repo/Src/Base/AMReX_GpuControl.H"
+    "/root/repo/Src/Base/AMReX_GpuLaunch.H"
+    "/root/repo/Src/Base/AMReX_GpuLaunchGlobal.H"
+    "/root/repo/Src/Base/AMReX_GpuLaunchMacrosG.H"
+    "/root/repo/Src/Base/AMReX_GpuLaunchMacrosC.H"
+    "/root/repo/Src/Base/AMReX_GpuLaunchFunctsG.H"
+    "/root/repo/Src/Base/AMReX_GpuLaunchFunctsC.H"
+    "/root/repo/Src/Base/AMReX_GpuError.H"
+    "/root/repo/Src/Base/AMReX_GpuDevice.H"
+    "/root/repo/Src/Base/AMReX_GpuBuffer.H"
+    "/root/repo/Src/Base/AMReX_GpuAtomic.H"
+    "/root/repo/Src/Base/AMReX_GpuUtility.H"
+    "/root/repo/Src/Base/AMReX_GpuAsyncArray.H"
+    "/root/repo/Src/Base/AMReX_GpuElixir.H"
+    "/root/repo/Src/Base/AMReX_GpuMemory.H"
+    "/root/repo/Src/Base/AMReX_GpuRange.H"
+    "/root/repo/Src/Base/AMReX_GpuReduce.H"
+    "/root/repo/Src/Base/AMReX_GpuAllocators.H"
+    "/root/repo/Src/Base/AMReX_GpuContainers.H"
+    "/root/repo/Src/Base/AMReX_MFParallelFor.H"
+    "/root/repo/Src/Base/AMReX_MFParallelForC.H"
+    "/root/repo/Src/Base/AMReX_MFParallelForG.H"
+    "/root/repo/Src/Base/AMReX_TagParallelFor.H"
+    "/root/repo/Src/Base/AMReX_ParReduce.H"
+    "/root/repo/Src/Base/AMReX_CudaGraph.H"
+    "/root/repo/Src/Base/AMReX_Machine.H"
+    "/root/repo/Src/Base/AMReX_MemPool.H"
+    "/root/repo/Src/Base/Parser/AMReX_Parser.H"
+    "/root/repo/Src/Base/Parser/AMReX_Parser_Exe.H"
+    "/root/repo/Src/Base/Parser/AMReX_Parser_Y.H"
+    "/root/repo/Src/Base/Parser/AMReX_IParser.H"
+    "/root/repo/Src/Base/Parser/AMReX_IParser_Exe.H"
+    "/root/repo/Src/Base/Parser/AMReX_IParser_Y.H"
+    "/root/repo/Src/Base/AMReX_BaseFwd.H"
+    "/root/repo/Src/Boundary/AMReX_FabSet.H"
+    "/root/repo/Src/Boundary/AMReX_BndryRegister.H"
+    "/root/repo/Src/Boundary/AMReX_Mask.H"
+    "/root/repo/Src/Boundary/AMReX_MultiMask.H"
+    "/root/repo/Src/Boundary/AMReX_BndryData.H"
+    "/root/repo/Src/Boundary/AMReX_BoundCond.H"
+    "/root/repo/Src/Boundary/AMReX_InterpBndryData.H"
+    "/root/repo/Src/Boundary/AMReX_LO_BCTYPES.H"
+    "/root/repo/Src/Boundary/AMReX_MacBndry.H"
+    "/root/repo/Src/Boundary/AMReX_InterpBndryData_K.H"
+    "/root/repo/Src/Boundary/AMReX_InterpBndryData_3D_K.H"
+    "/root/repo/Src/Boundary/AMReX_LOUtil_K.H"
+    "/root/repo/Src/Boundary/AMReX_YAFluxRegister.H"
+    "/root/repo/Src/Boundary/AMReX_YAFluxRegister_K.H"
+    "/root/repo/Src/Boundary/AMReX_YAFluxRegister_3D_K.H"
+    "/root/repo/Src/Boundary/AMReX_BoundaryFwd.H"
+    "/root/repo/Src/AmrCore/AMReX_AmrCore.H"
+    "/root/repo/Src/AmrCore/AMReX_Cluster.H"
+    "/root/repo/Src/AmrCore/AMReX_ErrorList.H"
+    "/root/repo/Src/AmrCore/AMReX_FillPatchUtil.H"
+    "/root/repo/Src/AmrCore/AMReX_FillPatchUtil_I.H"
+    "/root/repo/Src/AmrCore/AMReX_FluxRegister.H"
+    "/root/repo/Src/AmrCore/AMReX_InterpBase.H"
+    "/root/repo/Src/AmrCore/AMReX_MFInterpolater.H"
+    "/root/repo/Src/AmrCore/AMReX_Interpolater.H"
+    "/root/repo/Src/AmrCore/AMReX_TagBox.H"
+    "/root/repo/Src/AmrCore/AMReX_AmrMesh.H"
+    "/root/repo/Src/AmrCore/AMReX_FluxReg_3D_C.H"
+    "/root/repo/Src/AmrCore/AMReX_FluxReg_C.H"
+    "/root/repo/Src/AmrCore/AMReX_Interp_C.H"
+    "/root/repo/Src/AmrCore/AMReX_Interp_3D_C.H"
+    "/root/repo/Src/AmrCore/AMReX_MFInterp_C.H"
+    "/root/repo/Src/AmrCore/AMReX_MFInterp_3D_C.H"
+    "/root/repo/Src/AmrCore/AMReX_InterpFaceRegister.H"
+    "/root/repo/Src/AmrCore/AMReX_InterpFaceReg_C.H"
+    "/root/repo/Src/AmrCore/AMReX_InterpFaceReg_3D_C.H"
+    "/root/repo/Src/AmrCore/AMReX_AmrCoreFwd.H"
+    "/root/repo/Src/AmrCore/AMReX_AmrParGDB.H"
+    "/root/repo/Src/AmrCore/AMReX_AmrParticles.H"
+    "/root/repo/Src/Amr/AMReX_LevelBld.H"
+    "/root/repo/Src/Amr/AMReX_Amr.H"
+    "/root/repo/Src/Amr/AMReX_AmrLevel.H"
+    "/root/repo/Src/Amr/AMReX_Derive.H"
+    "/root/repo/Src/Amr/AMReX_StateData.H"
+    "/root/repo/Src/Amr/AMReX_PROB_AMR_F.H"
+    "/root/repo/Src/Amr/AMReX_StateDescriptor.H"
+    "/root/repo/Src/Amr/AMReX_AuxBoundaryData.H"
+    "/root/repo/Src/Amr/AMReX_Extrapolater.H"
+    "/root/repo/Src/Amr/AMReX_extrapolater_K.H"
+    "/root/repo/Src/Amr/AMReX_extrapolater_3D_K.H"
+    "/root/repo/Src/Amr/AMReX_AmrFwd.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLMG.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLMG_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLMG_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLMGBndry.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLLinOp.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLLinOp_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLCellLinOp.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLNodeLinOp.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLCellABecLap.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLCellABecLap_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLCellABecLap_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLCGSolver.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_GMRES_MLMG.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLABecLaplacian.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLABecLap_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLABecLap_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLALaplacian.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLALap_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLALap_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLPoisson.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLPoisson_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLPoisson_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLNodeLaplacian.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLNodeLap_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLNodeLap_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLNodeTensorLaplacian.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLNodeTensorLap_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLNodeTensorLap_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLTensorOp.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLTensor_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLTensor_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLEBNodeFDLaplacian.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLEBNodeFDLap_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLEBNodeFDLap_3D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLMG_2D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLPoisson_2D_K.H"
+    "/root/repo/Src/LinearSolvers/MLMG/AMReX_MLALap_2D_K.H"
+    "/root/repo/Src/Particle/AMReX_Particles.H"
+    "/root/repo/Src/Particle/AMReX_SparseBins.H"
+    "/root/repo/Src/Particle/AMReX_ParGDB.H"
+    "/root/repo/Src/Particle/AMReX_Particle_mod_K.H"
+    "/root/repo/Src/Particle/AMReX_TracerParticles.H"
+    "/root/repo/Src/Particle/AMReX_NeighborParticles.H"
+    "/root/repo/Src/Particle/AMReX_NeighborParticlesI.H"
+    "/root/repo/Src/Particle/AMReX_NeighborList.H"
+    "/root/repo/Src/Particle/AMReX_Particle.H"
+    "/root/repo/Src/Particle/AMReX_ParticleInit.H"
+    "/root/repo/Src/Particle/AMReX_ParticleContainerI.H"
+    "/root/repo/Src/Particle/AMReX_ParIter.H"
+    "/root/repo/Src/Particle/AMReX_ParticleMPIUtil.H"
+    "/root/repo/Src/Particle/AMReX_ParticleUtil.H"
+    "/root/repo/Src/Particle/AMReX_StructOfArrays.H"
+    "/root/repo/Src/Particle/AMReX_ArrayOfStructs.H"
+    "/root/repo/Src/Particle/AMReX_ParticleTile.H"
+    "/root/repo/Src/Particle/AMReX_NeighborParticlesCPUImpl.H"
+    "/root/repo/Src/Particle/AMReX_NeighborParticlesGPUImpl.H"
+    "/root/repo/Src/Particle/AMReX_ParticleBufferMap.H"
+    "/root/repo/Src/Particle/AMReX_ParticleCommunication.H"
+    "/root/repo/Src/Particle/AMReX_ParticleInterpolators.H"
+    "/root/repo/Src/Particle/AMReX_ParticleReduce.H"
+    "/root/repo/Src/Particle/AMReX_ParticleMesh.H"
+    "/root/repo/Src/Particle/AMReX_ParticleLocator.H"
+    "/root/repo/Src/Particle/AMReX_ParticleCompact.H"
+    "/root/repo/Src/Particle/AMReX_ParticleIO.H"
+    "/root/repo/Src/Particle/AMReX_DenseBins.H"
+    "/root/repo/Src/Particle/AMReX_BinIterator.H"
+    "/root/repo/Src/Particle/AMReX_ParticleTransformation.H"
+    "/root/repo/Src/Particle/AMReX_WriteBinaryParticleData.H"
+    "/root/repo/Src/Particle/AMReX_ParticleContainerBase.H"
+    "/root/repo/Src/Particle/AMReX_ParticleArray.H"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/AMReX/AMReXTargets.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/AMReX/AMReXTargets.cmake"
+         "/root/repo/_gate_build_mpi/CMakeFiles/Export/2260e541ece776bcef17e59de6c71ec8/AMReXTargets.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/AMReX/AMReXTargets-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/AMReX/AMReXTargets.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/AMReX" TYPE FILE FILES "/root/repo/_gate_build_mpi/CMakeFiles/Export/2260e541ece776bcef17e59de6c71ec8/AMReXTargets.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/AMReX" TYPE FILE FILES "/root/repo/_gate_build_mpi/CMakeFiles/Export/2260e541ece776bcef17e59de6c71ec8/AMReXTargets-release.cmake")
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/Tools" TYPE DIRECTORY FILES
+    "/root/repo/Tools/CMake"
+    "/root/repo/Tools/C_scripts"
+    "/root/repo/Tools/typechecker"
+    USE_SOURCE_PERMISSIONS)
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_gate_build_mpi/Tests/cmake_install.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/_gate_build_mpi/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")